@@ -126,6 +126,9 @@ protected:
 
   std::map<std::string, paramsPtr> _name_to_params_pointer;
 
+  /// The valid parameters of the applications, built once for all the Apps of a MultiApp
+  std::map<std::string, InputParameters> _valid_params;
+
   static AppFactory _instance;
 
 private:
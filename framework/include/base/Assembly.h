@@ -19,6 +19,10 @@
 #include "libmesh/fe_type.h"
 #include "libmesh/tensor_tools.h"
 
+#include <list>
+#include <set>
+#include <unordered_map>
+
 // libMesh forward declarations
 namespace libMesh
 {
@@ -544,6 +548,49 @@ public:
    */
   void addCachedResidual(NumericVector<Number> & residual, TagID tag_id);
 
+  /**
+   * Caches the contribution of a save_in or diag_save_in variable to \p vector (usually the
+   * solution of the auxiliary system). Every thread has its own cache, so that the contributions
+   * can be collected without locking. They are added to \p vector in addCachedVectorValues().
+   *
+   * @param vector The vector the contribution will be added to
+   * @param values The values of the contribution
+   * @param dof_indices The degrees of freedom the values will be added to
+   */
+  void cacheSaveIn(NumericVector<Number> & vector,
+                   const DenseVector<Number> & values,
+                   const std::vector<dof_id_type> & dof_indices);
+
+  /**
+   * Caches a single save_in or diag_save_in contribution, see cacheSaveIn() above.
+   */
+  void cacheSaveIn(NumericVector<Number> & vector, dof_id_type dof, Real value);
+
+  /**
+   * Multiplies the element Jacobian blocks for the matrix tag \p tag with the entries of \p x
+   * and caches the products for \p y, instead of caching the blocks for a global matrix. This
+   * applies the Jacobian without assembling it. If \p x is nullptr, the diagonal entries of the
+   * blocks are cached instead.
+   *
+   * The products are added to \p y in addCachedVectorValues().
+   */
+  void cacheJacobianAction(const NumericVector<Number> * x, NumericVector<Number> & y, TagID tag);
+
+  /**
+   * Replaces the rows of \p y cached with cacheJacobianContribution() (by the NodalBCs) with the
+   * product of the cached Jacobian entries and \p x, or with the diagonal entries if \p x is
+   * nullptr. This is the matrix-free counterpart of setCachedJacobianContributions().
+   */
+  void setCachedJacobianContributionsAction(const NumericVector<Number> * x,
+                                            NumericVector<Number> & y,
+                                            TagID tag);
+
+  /**
+   * Adds the values cached by cacheSaveIn() and cacheJacobianAction() to their vectors and
+   * clears the cache. This must not be called by several threads at once.
+   */
+  void addCachedVectorValues();
+
   void setResidual(NumericVector<Number> & residual, TagID tag_id = 0);
   void setResidualNeighbor(NumericVector<Number> & residual, TagID tag_id = 0);
 
@@ -803,6 +850,16 @@ public:
     return _fe_shape_data[type]->_second_phi;
   }
 
+  /**
+   * The volume shape function gradients of an FE type on the current element in a flat
+   * structure-of-arrays layout [component][function][qp]. The data is built on the first request
+   * after each element reinit and shared by all objects requesting it, so that the residual and
+   * the Jacobian contributions of an element don't convert it again.
+   * @param type The FE type of the shape functions
+   * @param n_dim The number of gradient components to store
+   */
+  const std::vector<Real> & feGradPhiSoA(FEType type, unsigned int n_dim);
+
   template <typename OutputType>
   const typename OutputTools<OutputType>::VariablePhiValue & fePhiFace(FEType type)
   {
@@ -936,6 +993,36 @@ public:
    */
   void setXFEM(std::shared_ptr<XFEMInterface> xfem) { _xfem = xfem; }
 
+  /**
+   * Turn on or off caching of the volume shape functions, gradients, quadrature points and JxW
+   * computed by reinit(const Elem *).
+   *
+   * Elements with an affine map share the data with all congruent (translated) elements, all
+   * other elements keep their own data. The cache must be cleared with clearFEShapeCache()
+   * whenever the mesh changes, so it must not be used on a displaced mesh. While it is on, objects
+   * reading the libMesh FE objects directly (getFE()) see the data of the last element that was
+   * not found in the cache.
+   *
+   * @param use Whether or not to use the cache
+   * @param max_bytes The memory the cache may use before the oldest entries are evicted
+   */
+  void useFEShapeCache(bool use, std::size_t max_bytes);
+
+  /**
+   * Drop all the data in the FE shape cache
+   */
+  void clearFEShapeCache();
+
+  /**
+   * Retrieve and reset the FE shape cache counters
+   * @param hits Number of element reinits served by the cache
+   * @param misses Number of element reinits that computed the data
+   * @param evictions Number of entries evicted to stay within the memory limit
+   */
+  void feShapeCacheCounters(unsigned long int & hits,
+                            unsigned long int & misses,
+                            unsigned long int & evictions);
+
 protected:
   /**
    * Just an internal helper function to reinit the volume FE objects.
@@ -944,6 +1031,13 @@ protected:
    */
   void reinitFE(const Elem * elem);
 
+  /**
+   * reinitFE() that goes through the FE shape cache
+   *
+   * @param elem The element we are using to reinit
+   */
+  void reinitFECached(const Elem * elem);
+
   /**
    * Just an internal helper function to reinit the face FE objects.
    *
@@ -1261,6 +1355,68 @@ protected:
   std::map<FEType, VectorFEShapeData *> _vector_fe_shape_data_neighbor;
   std::map<FEType, VectorFEShapeData *> _vector_fe_shape_data_face_neighbor;
 
+  /**
+   * Volume shape function data of an element (or of a set of congruent elements) kept by the FE
+   * shape cache
+   */
+  class CachedFEData
+  {
+  public:
+    std::map<FEType, std::vector<std::vector<Real>>> _phi;
+    std::map<FEType, std::vector<std::vector<RealGradient>>> _grad_phi;
+    std::map<FEType, std::vector<std::vector<RealTensor>>> _second_phi;
+    std::map<FEType, std::vector<std::vector<RealVectorValue>>> _vector_phi;
+    std::map<FEType, std::vector<std::vector<RealTensor>>> _vector_grad_phi;
+    std::map<FEType, std::vector<std::vector<TypeNTensor<3, Real>>>> _vector_second_phi;
+    std::map<FEType, std::vector<std::vector<RealVectorValue>>> _vector_curl_phi;
+    std::vector<Point> _q_points;
+    std::vector<Real> _JxW;
+    /// The first node of the element the data was computed on (q_points are shifted from there)
+    Point _origin;
+    /// Approximate memory used by this entry
+    std::size_t _bytes;
+  };
+
+  /// Hash for the FE shape cache keys
+  struct FECacheKeyHash
+  {
+    std::size_t operator()(const std::vector<long int> & key) const;
+  };
+
+  /// Fills in the key of elem in the FE shape cache
+  void feCacheKey(const Elem * elem, std::vector<long int> & key) const;
+
+  /// Points the shape data at a cache entry, returns false if the entry lacks some of the data
+  bool restoreFromFECache(const Elem * elem, CachedFEData & data);
+
+  /// Copies the data of the FE objects just reinited on elem into the cache
+  void storeInFECache(const Elem * elem, const std::vector<long int> & key);
+
+  /// Whether or not reinit(const Elem *) goes through the FE shape cache
+  bool _use_fe_cache;
+  /// The memory the FE shape cache may use
+  std::size_t _fe_cache_max_bytes;
+  /// The memory the FE shape cache currently uses
+  std::size_t _fe_cache_bytes;
+  /// The FE shape cache, keyed on the element (or its affine map signature) and quadrature rule
+  std::unordered_map<std::vector<long int>, CachedFEData, FECacheKeyHash> _fe_cache;
+  /// Cache keys in insertion order for eviction
+  std::list<std::vector<long int>> _fe_cache_order;
+  /// Work key to avoid reallocating it
+  std::vector<long int> _fe_cache_key;
+  /// Quadrature points of the current element when they were shifted from a cache entry
+  std::vector<Point> _fe_cache_q_points;
+  ///@{ FE shape cache counters
+  unsigned long int _fe_cache_hits;
+  unsigned long int _fe_cache_misses;
+  unsigned long int _fe_cache_evictions;
+  ///@}
+
+  /// Structure-of-arrays copies of the volume shape function gradients, see feGradPhiSoA()
+  std::map<FEType, std::vector<Real>> _grad_phi_soa;
+  /// The FE types whose structure-of-arrays gradients are up to date with the current element
+  std::set<FEType> _grad_phi_soa_current;
+
   /// Values cached by calling cacheResidual() (the first vector is for TIME vs NONTIME)
   std::vector<std::vector<Real>> _cached_residual_values;
 
@@ -1269,6 +1425,23 @@ protected:
 
   unsigned int _max_cached_residuals;
 
+  /// Values cached for one vector (other than the tagged residuals)
+  struct CachedVectorValues
+  {
+    NumericVector<Number> * _vector;
+    std::vector<Real> _values;
+    std::vector<dof_id_type> _rows;
+  };
+
+  /// Values cached by calling cacheSaveIn() or cacheJacobianAction(), one entry for each vector
+  std::vector<CachedVectorValues> _cached_vector_values;
+
+  /// Returns the cache for \p vector, adding one if there is none yet
+  CachedVectorValues & cachedVectorValues(NumericVector<Number> & vector);
+
+  /// Entries of the vector the Jacobian is applied to, see cacheJacobianAction()
+  std::vector<Number> _jacobian_action_values;
+
   /// Values cached by calling cacheJacobian()
   std::vector<std::vector<Real>> _cached_jacobian_values;
   /// Row where the corresponding cached value should go
@@ -267,7 +267,8 @@ public:
   }
 
   /**
-   * Get valid parameters for the object
+   * Get valid parameters for the object.  The validParams function of each object is only called
+   * once, this returns a copy of its result.
    * @param name Name of the object whose parameter we are requesting
    * @return Parameters of the object
    */
@@ -303,7 +304,7 @@ public:
                             THREAD_ID tid = 0)
   {
     std::shared_ptr<T> new_object =
-        std::dynamic_pointer_cast<T>(create(obj_name, name, parameters, tid, false));
+        std::dynamic_pointer_cast<T>(create(obj_name, name, std::move(parameters), tid, false));
     if (!new_object)
       mooseError("We expected to create an object of type '" + demangle(typeid(T).name()) +
                  "'.\nInstead we received a parameters object for type '" + obj_name +
@@ -362,6 +363,13 @@ protected:
    */
   void reportUnregisteredError(const std::string & obj_name) const;
 
+  /**
+   * The valid parameters of a registered object, built by its validParams function on the first
+   * call
+   * @param obj_name Type of the object
+   */
+  const InputParameters & cachedValidParams(const std::string & obj_name);
+
   /// Reference to the application
   MooseApp & _app;
 
@@ -371,6 +379,9 @@ protected:
   /// Storage for pointers to the parameters objects
   std::map<std::string, paramsPtr> _name_to_params_pointer;
 
+  /// The valid parameters of the objects whose parameters were requested, see cachedValidParams()
+  std::map<std::string, InputParameters> _valid_params;
+
   FileLineInfoMap _name_to_line;
 
   /// Object name to class name association
@@ -13,6 +13,7 @@
 // MOOSE includes
 #include "Constraint.h"
 #include "NeighborCoupleableMooseVariableDependencyIntermediateInterface.h"
+#include "MooseMesh.h"
 
 // Forward Declarations
 class NodeElemConstraint;
@@ -225,7 +226,7 @@ protected:
   /// DOF map
   const DofMap & _dof_map;
 
-  const std::map<dof_id_type, std::vector<dof_id_type>> & _node_to_elem_map;
+  const MooseMesh::NodeToElemMap & _node_to_elem_map;
 
   /// maps slave node ids to master element ids
   std::map<dof_id_type, dof_id_type> _slave_to_master_map;
@@ -13,6 +13,7 @@
 // MOOSE includes
 #include "Constraint.h"
 #include "NeighborCoupleableMooseVariableDependencyIntermediateInterface.h"
+#include "MooseMesh.h"
 
 // Forward Declarations
 class NodeFaceConstraint;
@@ -252,7 +253,7 @@ protected:
   /// DOF map
   const DofMap & _dof_map;
 
-  const std::map<dof_id_type, std::vector<dof_id_type>> & _node_to_elem_map;
+  const MooseMesh::NodeToElemMap & _node_to_elem_map;
 
   /**
    * Whether or not the slave's residual should be overwritten.
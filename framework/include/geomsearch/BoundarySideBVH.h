@@ -0,0 +1,129 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef BOUNDARYSIDEBVH_H
+#define BOUNDARYSIDEBVH_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+#include "libmesh/bounding_box.h"
+
+// C++ includes
+#include <tuple>
+#include <vector>
+
+// Forward declarations
+class MooseMesh;
+
+/**
+ * A bounding volume hierarchy over the element sides of one boundary.
+ *
+ * Every side gets an axis aligned box around its nodes, inflated by the largest extent of the
+ * box so that points a side length away from a flat face are still inside it.  The tree is
+ * built once by median splits of the box centers and refit() updates the boxes for the current
+ * node positions (e.g. of the displaced mesh) without changing the tree.  The tree is rebuilt
+ * when the sides moved so much that the boxes of its nodes grew to twice their size.
+ *
+ * The sides of each element on the boundary are stored as well, so that they can be looked up
+ * without searching the side list of the whole mesh.
+ */
+class BoundarySideBVH
+{
+public:
+  BoundarySideBVH(const MooseMesh & mesh, BoundaryID boundary);
+
+  /**
+   * Collect the sides on the boundary and build the tree.
+   * @param bc_tuples The (elem id, side, boundary id) tuples of the mesh
+   */
+  void build(const std::vector<std::tuple<dof_id_type, unsigned short int, boundary_id_type>> &
+                 bc_tuples);
+
+  /// Whether build() was called since the last clear()
+  bool isBuilt() const { return _built; }
+
+  /// Remove all sides, e.g. when the mesh changed
+  void clear();
+
+  /// Recompute the boxes for the current positions of the nodes
+  void refit();
+
+  /**
+   * The sides of an element that are on the boundary, in the order of the side list.
+   * @param elem_id The element
+   * @param sides The side numbers, cleared first
+   */
+  void elemSides(dof_id_type elem_id, std::vector<unsigned int> & sides) const;
+
+  /**
+   * Find the sides whose inflated box contains a point.  This is safe to call from threads.
+   * @param p The point
+   * @param tolerance An additional distance by which the boxes are inflated
+   * @param candidates The (elem id, side) pairs found, cleared first
+   */
+  void findCandidates(const Point & p,
+                      Real tolerance,
+                      std::vector<std::pair<dof_id_type, unsigned int>> & candidates) const;
+
+protected:
+  /// A side on the boundary and its inflated box
+  struct Side
+  {
+    dof_id_type _elem_id;
+    unsigned int _side;
+    BoundingBox _box;
+  };
+
+  /// A node of the tree, which covers the sides [_begin, _end)
+  struct TreeNode
+  {
+    BoundingBox _box;
+    std::size_t _begin;
+    std::size_t _end;
+    /// Index of the first child, the second one follows it.  0 for leaves.
+    std::size_t _left;
+  };
+
+  /// Compute the inflated box of a side from the current node positions
+  BoundingBox sideBox(const Side & side) const;
+
+  /// Build the subtree over the sides [begin, end) with its root at _tree[index]
+  void buildSubtree(std::size_t index, std::size_t begin, std::size_t end);
+
+  /// Compute the boxes of the tree nodes from the boxes of the sides, bottom up
+  void updateTreeBoxes();
+
+  /// Sum of the extents of the boxes of all tree nodes, a measure of the quality of the tree
+  Real treeExtent() const;
+
+  const MooseMesh & _mesh;
+
+  const BoundaryID _boundary;
+
+  /// Whether build() was called since the last clear()
+  bool _built;
+
+  /// The sides in tree order
+  std::vector<Side> _sides;
+
+  /// The tree nodes, the root is the first
+  std::vector<TreeNode> _tree;
+
+  /// The (elem id, side) pairs sorted by elem id and in side list order for each elem
+  std::vector<std::pair<dof_id_type, unsigned int>> _elem_sides;
+
+  /// treeExtent() of the last build
+  Real _built_extent;
+
+  /// Maximum number of sides in a leaf of the tree
+  static const std::size_t _max_leaf_size = 4;
+};
+
+#endif // BOUNDARYSIDEBVH_H
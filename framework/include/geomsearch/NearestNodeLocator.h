@@ -13,6 +13,7 @@
 // Moose
 #include "Restartable.h"
 #include "PerfGraphInterface.h"
+#include "CompressedRowMap.h"
 
 // Forward declarations
 class SubProblem;
@@ -95,6 +96,28 @@ protected:
 
   NodeIdRange * _slave_node_range;
 
+  /**
+   * Update the nearest node of each slave node by walking from its previous nearest node to
+   * connected master nodes as long as they are closer.  The slave nodes that moved further than
+   * the search tolerance since their last KDTree search get a new patch instead.
+   */
+  void walkToNearestNodes();
+
+  /// Connect each master node to the other master nodes of its elements for walkToNearestNodes()
+  void buildMasterNodeNeighbors(const std::vector<dof_id_type> & master_nodes);
+
+  /// Remember where the slave nodes were when their patch was found by a KDTree search
+  void saveSearchedPositions(const std::vector<dof_id_type> & slave_nodes);
+
+  /// Whether the nearest nodes are updated by walkToNearestNodes()
+  const bool _incremental_search;
+
+  /// The master nodes that share an element with each master node
+  CompressedRowMap<dof_id_type, dof_id_type> _master_node_neighbors;
+
+  /// The position of each slave node at its last KDTree search
+  std::map<dof_id_type, Point> _searched_positions;
+
 public:
   std::map<dof_id_type, NearestNodeInfo> _nearest_node_info;
 
@@ -123,6 +146,7 @@ public:
   PerfID _update_patch_timer;
   PerfID _reinit_timer;
   PerfID _update_ghosted_elems_timer;
+  PerfID _walk_to_nearest_nodes_timer;
 };
 
 #endif // NEARESTNODELOCATOR_H
@@ -0,0 +1,62 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef NEARESTNODEWALKTHREAD_H
+#define NEARESTNODEWALKTHREAD_H
+
+#include "NearestNodeLocator.h"
+
+/**
+ * Walks from the previous nearest node of each slave node to connected master nodes as long as
+ * they are closer.  The slave nodes that moved too far for the walk are collected instead.
+ */
+class NearestNodeWalkThread
+{
+public:
+  NearestNodeWalkThread(
+      const MooseMesh & mesh,
+      const std::map<dof_id_type, NearestNodeLocator::NearestNodeInfo> & previous_info,
+      const std::map<dof_id_type, std::vector<dof_id_type>> & neighbor_nodes,
+      const CompressedRowMap<dof_id_type, dof_id_type> & master_node_neighbors,
+      const std::map<dof_id_type, Point> & searched_positions);
+
+  // Splitting Constructor
+  NearestNodeWalkThread(NearestNodeWalkThread & x, Threads::split split);
+
+  void operator()(const NodeIdRange & range);
+
+  void join(const NearestNodeWalkThread & other);
+
+  // The updated info of the slave nodes that were found by the walk
+  std::map<dof_id_type, NearestNodeLocator::NearestNodeInfo> _nearest_node_info;
+
+  // The slave nodes that need a new patch
+  std::vector<dof_id_type> _moved_slave_nodes;
+
+protected:
+  // The Mesh
+  const MooseMesh & _mesh;
+
+  // The nearest node info the walk starts from
+  const std::map<dof_id_type, NearestNodeLocator::NearestNodeInfo> & _previous_info;
+
+  // The neighborhood nodes associated with each node
+  const std::map<dof_id_type, std::vector<dof_id_type>> & _neighbor_nodes;
+
+  // The master nodes that share an element with each master node
+  const CompressedRowMap<dof_id_type, dof_id_type> & _master_node_neighbors;
+
+  // The position of each slave node at its last KDTree search
+  const std::map<dof_id_type, Point> & _searched_positions;
+
+  // How far a slave node may move from its searched position before it needs a new patch
+  const Real _tolerance;
+};
+
+#endif // NEARESTNODEWALKTHREAD_H
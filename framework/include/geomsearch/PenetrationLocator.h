@@ -14,6 +14,7 @@
 #include "Restartable.h"
 #include "PenetrationInfo.h"
 #include "PerfGraphInterface.h"
+#include "BoundarySideBVH.h"
 
 #include "libmesh/vector_value.h"
 #include "libmesh/point.h"
@@ -101,6 +102,9 @@ protected:
 
   const Moose::PatchUpdateType _patch_update_strategy; // Contact patch update strategy
 
+  /// The master sides, which are refit for the current positions when searched with the BVH
+  BoundarySideBVH _master_bvh;
+
   /// Timers
   PerfID _detect_penetration_timer;
   PerfID _reinit_timer;
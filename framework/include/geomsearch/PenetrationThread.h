@@ -13,6 +13,7 @@
 // MOOSE includes
 #include "MooseTypes.h"
 #include "PenetrationLocator.h"
+#include "MooseMesh.h"
 
 // Forward declarations
 template <typename>
@@ -38,8 +39,8 @@ public:
       std::vector<std::vector<FEBase *>> & fes,
       FEType & fe_type,
       NearestNodeLocator & nearest_node,
-      const std::map<dof_id_type, std::vector<dof_id_type>> & node_to_elem_map,
-      const std::vector<std::tuple<dof_id_type, unsigned short int, boundary_id_type>> & bc_tuples);
+      const MooseMesh::NodeToElemMap & node_to_elem_map,
+      const BoundarySideBVH & master_bvh);
 
   // Splitting Constructor
   PenetrationThread(PenetrationThread & x, Threads::split split);
@@ -77,10 +78,13 @@ protected:
 
   NearestNodeLocator & _nearest_node;
 
-  const std::map<dof_id_type, std::vector<dof_id_type>> & _node_to_elem_map;
+  const MooseMesh::NodeToElemMap & _node_to_elem_map;
 
-  // Each boundary condition tuple has three entries, (0=elem-id, 1=side-id, 2=bc-id)
-  const std::vector<std::tuple<dof_id_type, unsigned short int, boundary_id_type>> & _bc_tuples;
+  /// The sides on the master boundary
+  const BoundarySideBVH & _master_bvh;
+
+  /// The (elem id, side) pairs of the master sides found in the BVH for the current slave node
+  std::vector<std::pair<dof_id_type, unsigned int>> _bvh_candidates;
 
   THREAD_ID _tid;
 
@@ -154,6 +158,12 @@ protected:
                          const std::vector<const Node *> & nodes_that_must_be_on_side,
                          const bool check_whether_reasonable = false);
 
+  /// Project the slave node onto a side of elem, which is then owned by the returned info
+  PenetrationInfo * createInfoForSide(const Node * slave_node,
+                                      const Elem * elem,
+                                      const Elem * side,
+                                      unsigned int side_num);
+
   void getSidesOnMasterBoundary(std::vector<unsigned int> & sides, const Elem * const elem);
 
   void computeSlip(FEBase & fe, PenetrationInfo & info);
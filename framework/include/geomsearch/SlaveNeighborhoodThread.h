@@ -14,9 +14,9 @@
 #include "MooseTypes.h"
 #include "NearestNodeLocator.h"
 #include "KDTree.h"
+#include "MooseMesh.h"
 
 // Forward declarations
-class MooseMesh;
 class NearestNodeLocator;
 class KDTree;
 
@@ -27,7 +27,7 @@ public:
 
   SlaveNeighborhoodThread(const MooseMesh & mesh,
                           const std::vector<dof_id_type> & trial_master_nodes,
-                          const std::map<dof_id_type, std::vector<dof_id_type>> & node_to_elem_map,
+                          const MooseMesh::NodeToElemMap & node_to_elem_map,
                           const unsigned int patch_size,
                           KDTree & _kd_tree);
 
@@ -55,7 +55,7 @@ protected:
   const std::vector<dof_id_type> & _trial_master_nodes;
 
   /// Node to elem map
-  const std::map<dof_id_type, std::vector<dof_id_type>> & _node_to_elem_map;
+  const MooseMesh::NodeToElemMap & _node_to_elem_map;
 
   /// The number of nodes to keep
   unsigned int _patch_size;
@@ -29,6 +29,13 @@ public:
   /// Compute this Kernel's contribution to the diagonal Jacobian entries
   virtual void computeJacobian() override;
 
+  /**
+   * Compute the residual and the diagonal Jacobian entries in one pass over the test functions if
+   * the derived class opted in through _fuse_residual_and_jacobian. Otherwise computeResidual()
+   * and computeJacobian() are called, which may be overridden.
+   */
+  virtual void computeResidualAndJacobian() override;
+
   /// Computes d-residual / d-jvar... storing the result in Ke.
   virtual void computeOffDiagJacobian(MooseVariableFEBase & jvar) override;
 
@@ -72,6 +79,12 @@ protected:
 
   /// Derivative of u_dot with respect to u
   const VariableValue & _du_dot_du;
+
+  /**
+   * Set by derived classes whose residual and Jacobian are fully described by computeQpResidual()
+   * and computeQpJacobian() to let computeResidualAndJacobian() form both in a single pass
+   */
+  bool _fuse_residual_and_jacobian;
 };
 
 #endif /* KERNEL_H */
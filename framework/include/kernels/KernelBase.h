@@ -69,6 +69,13 @@ public:
   /// Compute this Kernel's contribution to the diagonal Jacobian entries
   virtual void computeJacobian() = 0;
 
+  /**
+   * Compute this Kernel's contribution to the residual and to the diagonal Jacobian entries
+   * during a single visit of the current element. The default implementation simply calls
+   * computeResidual() followed by computeJacobian().
+   */
+  virtual void computeResidualAndJacobian();
+
   /// Computes d-residual / d-jvar... storing the result in Ke.
   virtual void computeOffDiagJacobian(MooseVariableFEBase & jvar) = 0;
 
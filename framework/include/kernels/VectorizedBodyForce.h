@@ -0,0 +1,48 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef VECTORIZEDBODYFORCE_H
+#define VECTORIZEDBODYFORCE_H
+
+#include "VectorizedKernel.h"
+
+// Forward Declarations
+class VectorizedBodyForce;
+class Function;
+
+template <>
+InputParameters validParams<VectorizedBodyForce>();
+
+/**
+ * BodyForce with all quadrature points of an element computed at once, see VectorizedKernel
+ */
+class VectorizedBodyForce : public VectorizedKernel
+{
+public:
+  VectorizedBodyForce(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+
+  virtual void computeResidualBatch(DenseVector<Number> & re) override;
+
+  /// Scale factor
+  const Real & _scale;
+
+  /// Optional function value
+  Function & _function;
+
+  /// Optional Postprocessor value
+  const PostprocessorValue & _postprocessor;
+
+  /// The weighted body force at the quadrature points
+  std::vector<Real> _force;
+};
+
+#endif // VECTORIZEDBODYFORCE_H
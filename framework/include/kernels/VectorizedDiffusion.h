@@ -0,0 +1,36 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef VECTORIZEDDIFFUSION_H
+#define VECTORIZEDDIFFUSION_H
+
+#include "VectorizedKernel.h"
+
+class VectorizedDiffusion;
+
+template <>
+InputParameters validParams<VectorizedDiffusion>();
+
+/**
+ * Diffusion with all quadrature points of an element computed at once, see VectorizedKernel
+ */
+class VectorizedDiffusion : public VectorizedKernel
+{
+public:
+  VectorizedDiffusion(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+
+  virtual void computeResidualBatch(DenseVector<Number> & re) override;
+  virtual void computeJacobianBatch(DenseMatrix<Number> & ke) override;
+};
+
+#endif // VECTORIZEDDIFFUSION_H
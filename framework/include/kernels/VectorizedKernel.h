@@ -0,0 +1,121 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef VECTORIZEDKERNEL_H
+#define VECTORIZEDKERNEL_H
+
+#include "Kernel.h"
+
+// Forward Declarations
+class VectorizedKernel;
+
+template <>
+InputParameters validParams<VectorizedKernel>();
+
+/**
+ * Base class for kernels that compute the contributions of all quadrature points of an element at
+ * once instead of calling computeQpResidual() for every (i, qp) pair.
+ *
+ * Before the batch methods are called the quadrature point data is available in flat
+ * structure-of-arrays buffers (one contiguous array over the quadrature points per test function
+ * and gradient component), so that the innermost loops over the quadrature points can be
+ * vectorized by the compiler. The shape function gradients come from Assembly, which converts
+ * them once per element for all kernels of the same FE type. The scalar computeQp* methods are
+ * still required: they are used for the off-diagonal Jacobian and when vectorization is turned
+ * off.
+ */
+class VectorizedKernel : public Kernel
+{
+public:
+  VectorizedKernel(const InputParameters & parameters);
+
+  virtual void computeResidual() override;
+
+  virtual void computeJacobian() override;
+
+  virtual void computeResidualAndJacobian() override;
+
+protected:
+  /**
+   * Add the contributions of all test functions to re, i.e.
+   *   re(i) += sum_qp _jxw_coord[qp] * R_i(qp)
+   */
+  virtual void computeResidualBatch(DenseVector<Number> & re) = 0;
+
+  /**
+   * Add the contributions of all test and shape functions to ke, i.e.
+   *   ke(i, j) += sum_qp _jxw_coord[qp] * J_ij(qp)
+   * Defaults to the scalar computeQpJacobian() loop.
+   */
+  virtual void computeJacobianBatch(DenseMatrix<Number> & ke);
+
+  /**
+   * Copy the components of a gradient at the quadrature points into a buffer laid out as
+   * [component][qp]
+   */
+  void gatherGradients(const VariableGradient & grad, std::vector<Real> & soa) const;
+
+  /**
+   * Fill out[i * _n_qp + qp] = _test[i][qp] * w[qp]
+   */
+  void weightTest(const Real * w, std::vector<Real> & out) const;
+
+  /**
+   * Multiply every block of _n_qp consecutive entries of a structure-of-arrays buffer by w[qp]
+   */
+  void weightBlocks(const Real * w, std::vector<Real> & soa) const;
+
+  ///@{ Pointers to the quadrature point values of one test/shape function (component)
+  const Real * test(unsigned int i) const { return _test[i].data(); }
+  const Real * phi(unsigned int j) const { return _phi[j].data(); }
+  const Real * gradTest(unsigned int d, unsigned int i) const
+  {
+    return &(*_grad_phi_soa)[(d * _n_test + i) * _n_qp];
+  }
+  const Real * gradPhi(unsigned int d, unsigned int j) const
+  {
+    return &(*_grad_phi_soa)[(d * _n_phi + j) * _n_qp];
+  }
+  const Real * gradU(unsigned int d) const { return &_grad_u_soa[d * _n_qp]; }
+  ///@}
+
+  /// Sum of a[qp] * b[qp] over the quadrature points with independent partial sums to allow
+  /// vectorization
+  Real qpDot(const Real * a, const Real * b) const;
+
+  /// Sum of a[qp] * b[qp] * w[qp] over the quadrature points, see qpDot()
+  Real qpDot(const Real * a, const Real * b, const Real * w) const;
+
+  /// Whether or not the batch methods are used
+  const bool _vectorize;
+
+  /// Number of gradient components stored in the structure-of-arrays buffers
+  unsigned int _n_dim;
+
+  /// Number of quadrature points, test and shape functions on the current element
+  unsigned int _n_qp;
+  unsigned int _n_test;
+  unsigned int _n_phi;
+
+  /// The integration weights times the coordinate transformation
+  std::vector<Real> _jxw_coord;
+
+  /// Structure-of-arrays shape function gradients of the current element owned by Assembly. The
+  /// test and the shape functions of the variable are the same, see gradTest() and gradPhi().
+  const std::vector<Real> * _grad_phi_soa;
+
+  /// Structure-of-arrays solution gradient, filled by the derived classes via gatherGradients()
+  std::vector<Real> _grad_u_soa;
+
+private:
+  /// Fill in the sizes and the integration weights for the current element
+  void prepareBatch();
+};
+
+#endif // VECTORIZEDKERNEL_H
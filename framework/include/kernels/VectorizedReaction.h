@@ -0,0 +1,39 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef VECTORIZEDREACTION_H
+#define VECTORIZEDREACTION_H
+
+#include "VectorizedKernel.h"
+
+class VectorizedReaction;
+
+template <>
+InputParameters validParams<VectorizedReaction>();
+
+/**
+ * Reaction with all quadrature points of an element computed at once, see VectorizedKernel
+ */
+class VectorizedReaction : public VectorizedKernel
+{
+public:
+  VectorizedReaction(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+
+  virtual void computeResidualBatch(DenseVector<Number> & re) override;
+  virtual void computeJacobianBatch(DenseMatrix<Number> & ke) override;
+
+  /// Weighted quadrature point values, [qp] for the residual and [i][qp] for the Jacobian
+  std::vector<Real> _weighted;
+};
+
+#endif // VECTORIZEDREACTION_H
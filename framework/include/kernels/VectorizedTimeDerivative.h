@@ -0,0 +1,41 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef VECTORIZEDTIMEDERIVATIVE_H
+#define VECTORIZEDTIMEDERIVATIVE_H
+
+#include "VectorizedKernel.h"
+
+class VectorizedTimeDerivative;
+
+template <>
+InputParameters validParams<VectorizedTimeDerivative>();
+
+/**
+ * TimeDerivative (without lumping) with all quadrature points of an element computed at once, see
+ * VectorizedKernel
+ */
+class VectorizedTimeDerivative : public VectorizedKernel
+{
+public:
+  VectorizedTimeDerivative(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+
+  virtual void computeResidualBatch(DenseVector<Number> & re) override;
+  virtual void computeJacobianBatch(DenseMatrix<Number> & ke) override;
+
+  /// Weighted quadrature point values
+  std::vector<Real> _weights;
+  std::vector<Real> _weighted_test;
+};
+
+#endif // VECTORIZEDTIMEDERIVATIVE_H
@@ -34,6 +34,10 @@ protected:
   virtual void computeFaceJacobian(BoundaryID bnd_id) override;
   virtual void computeInternalFaceJacobian(const Elem * neighbor) override;
   virtual void computeInternalInterFaceJacobian(BoundaryID bnd_id) override;
+
+  /// Compute the Jacobian blocks of the kernels with respect to their coupled scalar variables
+  void computeScalarOffDiagJacobian();
+
   NonlinearSystemBase & _nl;
 
   // Reference to BC storage structures
@@ -0,0 +1,52 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef COMPUTEJACOBIANACTIONTHREAD_H
+#define COMPUTEJACOBIANACTIONTHREAD_H
+
+#include "ComputeFullJacobianThread.h"
+
+// Forward declarations
+class FEProblemBase;
+
+/**
+ * Element loop that applies the element Jacobians to a vector instead of adding them to a matrix,
+ * see NonlinearSystemBase::computeJacobianAction(). The products are cached per thread and added
+ * to the result vector after the loop.
+ */
+class ComputeJacobianActionThread : public ComputeFullJacobianThread
+{
+public:
+  /**
+   * @param x The vector the Jacobian is applied to (ghosted), nullptr to compute the diagonal
+   * @param y The vector the result is added to
+   */
+  ComputeJacobianActionThread(FEProblemBase & fe_problem,
+                              const std::set<TagID> & tags,
+                              const NumericVector<Number> * x,
+                              NumericVector<Number> & y);
+
+  // Splitting Constructor
+  ComputeJacobianActionThread(ComputeJacobianActionThread & x, Threads::split split);
+
+  virtual ~ComputeJacobianActionThread();
+
+  virtual void postElement(const Elem * /*elem*/) override;
+
+  void join(const ComputeJacobianActionThread & /*y*/) {}
+
+protected:
+  /// The vector the Jacobian is applied to
+  const NumericVector<Number> * _x;
+
+  /// The result vector
+  NumericVector<Number> & _y;
+};
+
+#endif // COMPUTEJACOBIANACTIONTHREAD_H
@@ -25,8 +25,6 @@ public:
   // Splitting Constructor
   ComputeNodalKernelBcsThread(ComputeNodalKernelBcsThread & x, Threads::split split);
 
-  virtual void pre() override;
-
   virtual void onNode(ConstBndNodeRange::const_iterator & node_it) override;
 
   void join(const ComputeNodalKernelBcsThread & /*y*/);
@@ -35,9 +33,6 @@ protected:
   AuxiliarySystem & _aux_sys;
 
   const MooseObjectWarehouse<NodalKernel> & _nodal_kernels;
-
-  // Number of contributions cached up
-  unsigned int _num_cached;
 };
 
 #endif // COMPUTENODALKERNELBCSTHREAD_H
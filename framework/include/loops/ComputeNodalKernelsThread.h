@@ -29,8 +29,6 @@ public:
   // Splitting Constructor
   ComputeNodalKernelsThread(ComputeNodalKernelsThread & x, Threads::split split);
 
-  virtual void pre() override;
-
   virtual void onNode(ConstNodeRange::const_iterator & node_it) override;
 
   void join(const ComputeNodalKernelsThread & /*y*/);
@@ -39,9 +37,6 @@ protected:
   AuxiliarySystem & _aux_sys;
 
   const MooseObjectWarehouse<NodalKernel> & _nodal_kernels;
-
-  /// Number of contributions cached up
-  unsigned int _num_cached;
 };
 
 #endif // COMPUTENODALKERNELSTHREAD_H
@@ -0,0 +1,52 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef COMPUTERESIDUALANDJACOBIANTHREAD_H
+#define COMPUTERESIDUALANDJACOBIANTHREAD_H
+
+#include "ComputeFullJacobianThread.h"
+
+// Forward declarations
+class FEProblemBase;
+
+/**
+ * Element loop that forms the residual and the Jacobian together, so that each element (and each
+ * side) is reinitialized and has its materials computed only once per nonlinear iteration.
+ */
+class ComputeResidualAndJacobianThread : public ComputeFullJacobianThread
+{
+public:
+  ComputeResidualAndJacobianThread(FEProblemBase & fe_problem,
+                                   const std::set<TagID> & vector_tags,
+                                   const std::set<TagID> & matrix_tags);
+
+  // Splitting Constructor
+  ComputeResidualAndJacobianThread(ComputeResidualAndJacobianThread & x, Threads::split split);
+
+  virtual ~ComputeResidualAndJacobianThread();
+
+  virtual void subdomainChanged() override;
+  virtual void postElement(const Elem * /*elem*/) override;
+
+  void join(const ComputeResidualAndJacobianThread & /*y*/) {}
+
+protected:
+  virtual void computeJacobian() override;
+  virtual void computeFaceJacobian(BoundaryID bnd_id) override;
+  virtual void computeInternalFaceJacobian(const Elem * neighbor) override;
+  virtual void computeInternalInterFaceJacobian(BoundaryID bnd_id) override;
+
+  /// The vector tags the residual is formed for
+  const std::set<TagID> & _vector_tags;
+
+  /// Kernels contributing to the residual vector tags on the current subdomain
+  MooseObjectWarehouse<KernelBase> * _tag_kernels;
+};
+
+#endif // COMPUTERESIDUALANDJACOBIANTHREAD_H
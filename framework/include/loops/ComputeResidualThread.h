@@ -48,7 +48,6 @@ public:
 protected:
   NonlinearSystemBase & _nl;
   const std::set<TagID> & _tags;
-  unsigned int _num_cached;
 
   /// Reference to BC storage structures
   const MooseObjectWarehouse<IntegratedBCBase> & _integrated_bcs;
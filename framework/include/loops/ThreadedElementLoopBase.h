@@ -14,6 +14,8 @@
 #include "MooseMesh.h"
 #include "MooseTypes.h"
 #include "MooseException.h"
+#include "MooseApp.h"
+#include "PerfTraceGuard.h"
 
 /**
  * Base class for assembly-like calculations.
@@ -136,6 +138,9 @@ protected:
   MooseMesh & _mesh;
   THREAD_ID _tid;
 
+  /// The graph the time each thread spends on its part of the range is traced into
+  PerfGraph & _perf_graph;
+
   /// The subdomain for the current element
   SubdomainID _subdomain;
 
@@ -150,14 +155,15 @@ protected:
 };
 
 template <typename RangeType>
-ThreadedElementLoopBase<RangeType>::ThreadedElementLoopBase(MooseMesh & mesh) : _mesh(mesh)
+ThreadedElementLoopBase<RangeType>::ThreadedElementLoopBase(MooseMesh & mesh)
+  : _mesh(mesh), _perf_graph(mesh.getMooseApp().perfGraph())
 {
 }
 
 template <typename RangeType>
 ThreadedElementLoopBase<RangeType>::ThreadedElementLoopBase(ThreadedElementLoopBase & x,
                                                             Threads::split /*split*/)
-  : _mesh(x._mesh)
+  : _mesh(x._mesh), _perf_graph(x._perf_graph)
 {
 }
 
@@ -175,6 +181,12 @@ ThreadedElementLoopBase<RangeType>::operator()(const RangeType & range, bool byp
     ParallelUniqueId puid;
     _tid = bypass_threading ? 0 : puid.id;
 
+    // Shows the load balance between the threads in the timeline trace (when it is enabled)
+    PerfTraceGuard trace_guard(
+        _perf_graph,
+        _perf_graph.tracing() ? _perf_graph.registerSection(demangle(typeid(*this).name()), 3) : 0,
+        _tid);
+
     pre();
 
     _subdomain = Moose::INVALID_BLOCK_ID;
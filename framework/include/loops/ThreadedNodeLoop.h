@@ -12,6 +12,7 @@
 
 #include "FEProblemBase.h"
 #include "ParallelUniqueId.h"
+#include "PerfTraceGuard.h"
 
 template <typename RangeType, typename IteratorType>
 class ThreadedNodeLoop
@@ -68,18 +69,21 @@ public:
 protected:
   FEProblemBase & _fe_problem;
   THREAD_ID _tid;
+
+  /// The graph the time each thread spends on its part of the range is traced into
+  PerfGraph & _perf_graph;
 };
 
 template <typename RangeType, typename IteratorType>
 ThreadedNodeLoop<RangeType, IteratorType>::ThreadedNodeLoop(FEProblemBase & fe_problem)
-  : _fe_problem(fe_problem)
+  : _fe_problem(fe_problem), _perf_graph(fe_problem.getMooseApp().perfGraph())
 {
 }
 
 template <typename RangeType, typename IteratorType>
 ThreadedNodeLoop<RangeType, IteratorType>::ThreadedNodeLoop(ThreadedNodeLoop & x,
                                                             Threads::split /*split*/)
-  : _fe_problem(x._fe_problem)
+  : _fe_problem(x._fe_problem), _perf_graph(x._perf_graph)
 {
 }
 
@@ -92,6 +96,12 @@ ThreadedNodeLoop<RangeType, IteratorType>::operator()(const RangeType & range)
     ParallelUniqueId puid;
     _tid = puid.id;
 
+    // Shows the load balance between the threads in the timeline trace (when it is enabled)
+    PerfTraceGuard trace_guard(
+        _perf_graph,
+        _perf_graph.tracing() ? _perf_graph.registerSection(demangle(typeid(*this).name()), 3) : 0,
+        _tid);
+
     pre();
 
     for (IteratorType nd = range.begin(); nd != range.end(); ++nd)
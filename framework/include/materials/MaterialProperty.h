@@ -72,6 +72,21 @@ public:
   virtual void
   qpCopy(const unsigned int to_qp, PropertyValue * rhs, const unsigned int from_qp) = 0;
 
+  /**
+   * Make this Property operate on the n values of rhs starting at offset without copying them.
+   * The values this Property held before are set aside until detach() is called.
+   *
+   * @param rhs The (larger) Property holding the values.
+   * @param offset The first value of rhs this Property will operate on.
+   * @param n The number of values this Property will operate on.
+   */
+  virtual void attach(PropertyValue * rhs, const unsigned int offset, const unsigned int n) = 0;
+
+  /**
+   * Undo attach() and give this Property its own values back.  Does nothing if not attached.
+   */
+  virtual void detach() = 0;
+
   // save/restore in a file
   virtual void store(std::ostream & stream) = 0;
   virtual void load(std::istream & stream) = 0;
@@ -100,9 +115,13 @@ class MaterialProperty : public PropertyValue
 {
 public:
   /// Explicitly declare a public constructor because we made the copy constructor private
-  MaterialProperty() : PropertyValue() { /* */}
+  MaterialProperty() : PropertyValue(), _attached(false) { /* */}
 
-  virtual ~MaterialProperty() { _value.release(); }
+  virtual ~MaterialProperty()
+  {
+    detach();
+    _value.release();
+  }
 
   /**
    * @returns a read-only reference to the parameter value.
@@ -155,6 +174,10 @@ public:
    */
   virtual void qpCopy(const unsigned int to_qp, PropertyValue * rhs, const unsigned int from_qp);
 
+  virtual void attach(PropertyValue * rhs, const unsigned int offset, const unsigned int n);
+
+  virtual void detach();
+
   /**
    * Store the property into a binary stream
    */
@@ -198,6 +221,12 @@ private:
 
   /// Stored parameter value.
   MooseArray<T> _value;
+
+  /// Our own values, set aside while _value operates on the values of another Property
+  MooseArray<T> _detached_value;
+
+  /// Whether _value currently operates on the values of another Property
+  bool _attached;
 };
 
 // ------------------------------------------------------------
@@ -220,6 +249,8 @@ template <typename T>
 inline void
 MaterialProperty<T>::resize(int n)
 {
+  mooseAssert(!_attached || n <= static_cast<int>(_value.size()),
+              "Can't grow a material property that is attached to the stateful storage");
   _value.resize(n);
 }
 
@@ -241,6 +272,33 @@ MaterialProperty<T>::qpCopy(const unsigned int to_qp,
   _value[to_qp] = cast_ptr<const MaterialProperty<T> *>(rhs)->_value[from_qp];
 }
 
+template <typename T>
+inline void
+MaterialProperty<T>::attach(PropertyValue * rhs, const unsigned int offset, const unsigned int n)
+{
+  mooseAssert(rhs != NULL, "Attaching to NULL?");
+  mooseAssert(!_attached, "Material property is already attached");
+
+  MooseArray<T> & values = cast_ptr<MaterialProperty<T> *>(rhs)->_value;
+  mooseAssert(offset + n <= values.size(), "Attaching past the end of the values");
+
+  _detached_value.swap(_value);
+  _value.shallowCopy(n ? &values[offset] : NULL, n);
+  _attached = true;
+}
+
+template <typename T>
+inline void
+MaterialProperty<T>::detach()
+{
+  if (!_attached)
+    return;
+
+  _value.swap(_detached_value);
+  _detached_value.shallowCopy(NULL, 0);
+  _attached = false;
+}
+
 template <typename T>
 inline void
 MaterialProperty<T>::store(std::ostream & stream)
@@ -14,6 +14,9 @@
 #include "MaterialProperty.h"
 #include "HashMap.h"
 
+#include <map>
+#include <unordered_map>
+
 // Forward declarations
 class Material;
 class MaterialData;
@@ -28,7 +31,11 @@ class QBase;
 /**
  * Stores the stateful material properties computed by materials.
  *
- * Thread-safe
+ * The values are kept in one contiguous array per stateful property and state, indexed by a dense
+ * local element id and the quadrature point offset of the element side. Creating storage (initial
+ * setup, adaptivity, copies) locks, while swap() and swapBack() only look up existing storage and
+ * can be called from the element loops without locking. The places of erased element sides are
+ * reused for new storage.
  */
 class MaterialPropertyStorage
 {
@@ -105,7 +112,8 @@ public:
                              int input_side = -1);
 
   /**
-   * Initialize stateful material properties
+   * Initialize stateful material properties. Thread safe: storage creation, the material
+   * initialization and the copy to the old states are done while holding Threads::spin_mtx.
    * @param material_data MaterilData object used for computing the data
    * @param mats Materials that will compute the initial values
    * @param n_qpoints Number of quadrature points
@@ -118,6 +126,13 @@ public:
                          const Elem & elem,
                          unsigned int side = 0);
 
+  /**
+   * Release the storage of all sides of an element that was deleted or is no longer active. Not
+   * thread safe.
+   * @param elem The element to release the storage of
+   */
+  void eraseProps(const Elem * elem);
+
   /**
    * Shift the material properties in time.
    *
@@ -147,8 +162,9 @@ public:
             unsigned int n_qpoints);
 
   /**
-   * Swap (shallow copy) material properties in MaterialData and MaterialPropertyStorage
-   * Thread safe
+   * Swap (shallow copy) material properties in MaterialData and MaterialPropertyStorage: the
+   * stateful properties in MaterialData operate directly on the stored values until swapBack().
+   * Lock free, must not be called while storage is being created on another thread.
    * @param material_data MaterialData object to work with
    * @param elem Element id
    * @param side Side number (elemental material properties have this equal to zero)
@@ -156,8 +172,8 @@ public:
   void swap(MaterialData & material_data, const Elem & elem, unsigned int side);
 
   /**
-   * Swap (shallow copy) material properties in MaterialPropertyStorage and MaterialDat
-   * Thread safe
+   * Swap (shallow copy) material properties in MaterialPropertyStorage and MaterialData
+   * Lock free, see swap()
    * @param material_data MaterialData object to work with
    * @param elem Element id
    * @param side Side number (elemental material properties have this equal to zero)
@@ -176,46 +192,57 @@ public:
 
   ///@{
   /**
-   * Access methods to the stored material property data
-   *
+   * Access methods to the stored material property data. There is one PropertyValue per stateful
+   * property holding the values of all elements and sides; see qpOffset() for where the values of
+   * a particular element and side start.
    */
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & props()
-  {
-    return *_props_elem;
-  }
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & propsOld()
-  {
-    return *_props_elem_old;
-  }
-  HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & propsOlder()
-  {
-    return *_props_elem_older;
-  }
-  const HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & props() const
-  {
-    return *_props_elem;
-  }
-  const HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & propsOld() const
-  {
-    return *_props_elem_old;
-  }
-  const HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>> & propsOlder() const
-  {
-    return *_props_elem_older;
-  }
-  MaterialProperties & props(const Elem * elem, unsigned int side)
+  MaterialProperties & props() { return *_props_elem; }
+  MaterialProperties & propsOld() { return *_props_elem_old; }
+  MaterialProperties & propsOlder() { return *_props_elem_older; }
+  const MaterialProperties & props() const { return *_props_elem; }
+  const MaterialProperties & propsOld() const { return *_props_elem_old; }
+  const MaterialProperties & propsOlder() const { return *_props_elem_older; }
+  ///@}
+
+  /**
+   * @return Whether storage has been created for the element and side
+   */
+  bool hasProps(const Elem * elem, unsigned int side) const
   {
-    return (*_props_elem)[elem][side];
+    return qpOffset(elem, side) != libMesh::invalid_uint;
   }
-  MaterialProperties & propsOld(const Elem * elem, unsigned int side)
+
+  /**
+   * The position of the first quadrature point of an element side in the stored property data, or
+   * libMesh::invalid_uint if no storage has been created for it. Does not lock.
+   */
+  unsigned int qpOffset(const Elem * elem, unsigned int side) const
   {
-    return (*_props_elem_old)[elem][side];
+    auto it = _elem_to_local_id.find(elem);
+    if (it == _elem_to_local_id.end() || side >= _qp_offset[it->second].size())
+      return libMesh::invalid_uint;
+    return _qp_offset[it->second][side];
   }
-  MaterialProperties & propsOlder(const Elem * elem, unsigned int side)
+
+  /**
+   * The number of quadrature points stored for an element side (zero if there is no storage)
+   */
+  unsigned int nQpoints(const Elem * elem, unsigned int side) const
   {
-    return (*_props_elem_older)[elem][side];
+    auto it = _elem_to_local_id.find(elem);
+    if (it == _elem_to_local_id.end() || side >= _n_qpoints[it->second].size())
+      return 0;
+    return _n_qpoints[it->second][side];
   }
-  ///@}
+
+  /**
+   * The elements storage has been created for, indexed by their dense local id
+   */
+  const std::vector<const Elem *> & elems() const { return _local_id_to_elem; }
+
+  /// Save/restore the stored property data in a file
+  void store(std::ostream & stream, void * context);
+  void load(std::istream & stream, void * context);
 
   bool hasProperty(const std::string & prop_name) const;
 
@@ -240,11 +267,32 @@ public:
   }
 
 protected:
-  // indexing: [element][side]->material_properties
-  std::unique_ptr<HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>>> _props_elem;
-  std::unique_ptr<HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>>> _props_elem_old;
-  std::unique_ptr<HashMap<const Elem *, HashMap<unsigned int, MaterialProperties>>>
-      _props_elem_older;
+  /**
+   * The stored property data for the current, old and older states. Each holds one PropertyValue
+   * per stateful property (indexed like _stateful_prop_id_to_prop_id) with the values of all
+   * elements and sides laid out back to back, so that the quadrature point values of one element
+   * side are contiguous and start at its qpOffset().
+   */
+  std::unique_ptr<MaterialProperties> _props_elem;
+  std::unique_ptr<MaterialProperties> _props_elem_old;
+  std::unique_ptr<MaterialProperties> _props_elem_older;
+
+  /// Dense local id of every element storage has been created for
+  std::unordered_map<const Elem *, unsigned int> _elem_to_local_id;
+  /// The elements storage has been created for (inverse of _elem_to_local_id)
+  std::vector<const Elem *> _local_id_to_elem;
+  /// indexing: [local element id][side] -> position of the first qp in the stored property data
+  std::vector<std::vector<unsigned int>> _qp_offset;
+  /// indexing: [local element id][side] -> number of stored qps
+  std::vector<std::vector<unsigned int>> _n_qpoints;
+
+  /// Released ranges of the stored property data: number of quadrature points -> first position
+  std::multimap<unsigned int, unsigned int> _free_qps;
+
+  /// The number of quadrature point values handed out in each stored property
+  unsigned int _size;
+  /// The number of quadrature point values allocated in each stored property
+  unsigned int _capacity;
 
   /// mapping from property name to property ID
   /// NOTE: this is static so the property numbering is global within the simulation (not just FEProblemBase - should be useful when we will use material properties from
@@ -268,37 +316,36 @@ protected:
   /// the vector of stateful property ids (the vector index is the map to stateful prop_id)
   std::vector<unsigned int> _stateful_prop_id_to_prop_id;
 
-  void sizeProps(MaterialProperties & mp, unsigned int size);
-
 private:
-  /// Initializes hashmap entries for element and side to proper qpoint and
-  /// property count sizes.
+  /// Creates storage for element and side with the proper qpoint and property count sizes.
+  /// Callers must hold Threads::spin_mtx.
   void initProps(MaterialData & material_data,
                  const Elem & elem,
                  unsigned int side,
                  unsigned int n_qpoints);
+
+  /// Hand out the position of n_qpoints consecutive quadrature point values in the stored data
+  unsigned int allocateQps(unsigned int n_qpoints);
+
+  /// Make a range of the stored property data available to allocateQps() again
+  void releaseQps(unsigned int offset, unsigned int n_qpoints);
+
+  /// Grow the stored property data so that it can hold at least size quadrature point values
+  void reserve(unsigned int size);
 };
 
 template <>
 inline void
 dataStore(std::ostream & stream, MaterialPropertyStorage & storage, void * context)
 {
-  dataStore(stream, storage.props(), context);
-  dataStore(stream, storage.propsOld(), context);
-
-  if (storage.hasOlderProperties())
-    dataStore(stream, storage.propsOlder(), context);
+  storage.store(stream, context);
 }
 
 template <>
 inline void
 dataLoad(std::istream & stream, MaterialPropertyStorage & storage, void * context)
 {
-  dataLoad(stream, storage.props(), context);
-  dataLoad(stream, storage.propsOld(), context);
-
-  if (storage.hasOlderProperties())
-    dataLoad(stream, storage.propsOlder(), context);
+  storage.load(stream, context);
 }
 
 #endif /* MATERIALPROPERTYSTORAGE_H */
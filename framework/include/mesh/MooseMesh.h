@@ -16,6 +16,7 @@
 #include "Restartable.h"
 #include "MooseEnum.h"
 #include "PerfGraphInterface.h"
+#include "CompressedRowMap.h"
 
 #include <memory> //std::unique_ptr
 
@@ -142,11 +143,14 @@ public:
   void buildNodeList();
   void buildBndElemList();
 
+  /// A map from node ids to the ids of the elements connected to them, in ascending order
+  typedef CompressedRowMap<dof_id_type, dof_id_type> NodeToElemMap;
+
   /**
    * If not already created, creates a map from every node to all
    * elements to which they are connected.
    */
-  const std::map<dof_id_type, std::vector<dof_id_type>> & nodeToElemMap();
+  const NodeToElemMap & nodeToElemMap();
 
   /**
    * If not already created, creates a map from every node to all
@@ -155,7 +159,7 @@ public:
    * one node with a local element.
    * \note Extra ghosted elements are not included in this map!
    */
-  const std::map<dof_id_type, std::vector<dof_id_type>> & nodeToActiveSemilocalElemMap();
+  const NodeToElemMap & nodeToActiveSemilocalElemMap();
 
   /**
    * These structs are required so that the bndNodes{Begin,End} and
@@ -453,6 +457,24 @@ public:
    */
   const Moose::PatchUpdateType & getPatchUpdateStrategy() const;
 
+  /**
+   * Whether the penetration locator finds the candidate master faces of slave nodes in a
+   * bounding volume hierarchy instead of around the nearest master node.
+   */
+  bool useBVHPenetrationSearch() const { return _bvh_penetration_search; }
+
+  /**
+   * Whether the nearest node locators update the nearest nodes by walking from the previous ones
+   * over the master nodes connected by elements.
+   */
+  bool useIncrementalNearestNodeSearch() const { return _incremental_nearest_node_search; }
+
+  /**
+   * The distance a slave node may move before the incremental nearest node search falls back to
+   * a KDTree search for it.
+   */
+  Real getNearestNodeSearchTolerance() const { return _nearest_node_search_tolerance; }
+
   /**
    * Get a (slightly inflated) processor bounding box.
    *
@@ -916,13 +938,18 @@ protected:
       _bnd_elem_range;
 
   /// A map of all of the current nodes to the elements that they are connected to.
-  std::map<dof_id_type, std::vector<dof_id_type>> _node_to_elem_map;
+  NodeToElemMap _node_to_elem_map;
   bool _node_to_elem_map_built;
 
   /// A map of all of the current nodes to the active elements that they are connected to.
-  std::map<dof_id_type, std::vector<dof_id_type>> _node_to_active_semilocal_elem_map;
+  NodeToElemMap _node_to_active_semilocal_elem_map;
   bool _node_to_active_semilocal_elem_map_built;
 
+  /**
+   * Builds a node to elem map from the active elements in range
+   */
+  void buildNodeToElemMap(const ConstElemRange & range, NodeToElemMap & node_to_elem_map);
+
   /**
    * A set of subdomain IDs currently present in the mesh. For parallel meshes, includes subdomains
    * defined on other processors as well.
@@ -947,8 +974,8 @@ protected:
   std::vector<BndNode *> _bnd_nodes;
   typedef std::vector<BndNode *>::iterator bnd_node_iterator_imp;
   typedef std::vector<BndNode *>::const_iterator const_bnd_node_iterator_imp;
-  /// Map of sets of node IDs in each boundary
-  std::map<boundary_id_type, std::set<dof_id_type>> _bnd_node_ids;
+  /// Map of sorted node IDs in each boundary
+  std::map<boundary_id_type, std::vector<dof_id_type>> _bnd_node_ids;
 
   /// array of boundary elems
   std::vector<BndElement *> _bnd_elems;
@@ -983,6 +1010,15 @@ protected:
   /// The patch update strategy
   Moose::PatchUpdateType _patch_update_strategy;
 
+  /// Whether the penetration locator searches master faces in a bounding volume hierarchy
+  bool _bvh_penetration_search;
+
+  /// Whether the nearest node locators walk from the previous nearest nodes
+  bool _incremental_nearest_node_search;
+
+  /// Distance a slave node may move before the incremental search redoes the KDTree search for it
+  Real _nearest_node_search_tolerance;
+
   /// Vector of all the Nodes in the mesh for determining when to add a new point
   std::vector<Node *> _node_map;
 
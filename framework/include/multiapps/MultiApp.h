@@ -14,6 +14,9 @@
 #include "SetupInterface.h"
 #include "Restartable.h"
 
+// C++ includes
+#include <functional>
+
 class MultiApp;
 class UserObject;
 class FEProblemBase;
@@ -57,6 +60,8 @@ class MultiApp : public MooseObject, public SetupInterface, public Restartable
 public:
   MultiApp(const InputParameters & parameters);
 
+  virtual ~MultiApp();
+
   virtual void preExecute() {}
 
   virtual void postExecute();
@@ -280,6 +285,13 @@ public:
    */
   bool isRootProcessor() { return _my_rank == 0; }
 
+  /**
+   * Whether or not the Apps of this MultiApp may be moved to other processors during the
+   * simulation.  Objects holding on to local App numbers or to data stored on the local Apps
+   * cannot be used together with such a MultiApp.
+   */
+  virtual bool isLoadBalanced() const { return false; }
+
 protected:
   /**
    * _must_ fill in _positions with the positions of the sub-aps
@@ -301,6 +313,20 @@ protected:
    */
   void buildComm();
 
+  /**
+   * Disable 'concurrent_apps' if the Apps cannot be executed concurrently: they must each run on
+   * a single processor, with MPI providing MPI_THREAD_MULTIPLE and a thread safe PETSc.
+   */
+  void checkConcurrentApps();
+
+  /**
+   * The communicator to create an App with.  Apps executed concurrently each get their own
+   * duplicate of _my_comm, so that Apps on different threads never communicate on the same one.
+   *
+   * @param global_app The global app number of the App
+   */
+  MPI_Comm appComm(unsigned int global_app);
+
   /**
    * Map a global App number to the local number.
    * Note: This will error if given a global number that doesn't map to a local number.
@@ -310,9 +336,46 @@ protected:
    */
   unsigned int globalAppToLocal(unsigned int global_app);
 
+  /**
+   * Move Apps between the processors so that their cost is spread as evenly as possible.  Every
+   * processor keeps a contiguous block of at least one App, so this is only possible when there
+   * are at least as many Apps as processors.  This is a collective operation.
+   *
+   * @param local_costs The cost of each local App, e.g. its measured solve time
+   * @param tolerance The relative reduction of the largest cost on a processor that is required
+   * before any App is moved
+   * @return Whether or not any App was moved
+   */
+  bool balanceApps(const std::vector<Real> & local_costs, Real tolerance);
+
+  /**
+   * Give the Apps to new processors.  The state of each App that changes processor is sent
+   * as a Backup and restored into a newly created App on the receiving processor.
+   *
+   * @param first_apps The first global App of each processor followed by the total number of Apps
+   */
+  void redistributeApps(const std::vector<unsigned int> & first_apps);
+
+  /**
+   * Called for each App that was just recreated on this processor by redistributeApps(), before
+   * its state is restored from the Backup sent by its previous processor.
+   *
+   * @param i The local app number
+   */
+  virtual void setupRedistributedApp(unsigned int /*i*/) {}
+
   /// call back executed right before app->runInputFile()
   virtual void preRunInputFile();
 
+  /**
+   * Call a function for each local App.  With 'concurrent_apps' the calls are spread over the
+   * libMesh thread pool, otherwise they are made one after the other.  An exception thrown
+   * for a concurrently run App is rethrown once all of the Apps are done.
+   *
+   * @param func The function to call with each local app number
+   */
+  void forEachLocalApp(const std::function<void(unsigned int)> & func);
+
   /**
    * Initialize the MultiApp by creating the provided number of apps.
    *
@@ -410,6 +473,12 @@ protected:
   /// Whether or not this processor as an App _at all_
   bool _has_an_app;
 
+  /// Whether or not the local Apps are executed concurrently on threads
+  bool _concurrent_apps;
+
+  /// The communicators of the Apps executed concurrently, by global app number
+  std::map<unsigned int, MPI_Comm> _app_comms;
+
   /// Backups for each local App
   SubAppBackups & _backups;
 };
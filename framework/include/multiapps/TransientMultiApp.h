@@ -13,6 +13,10 @@
 #include "MultiApp.h"
 
 #include "libmesh/numeric_vector.h"
+#include "libmesh/threads.h"
+
+// C++ includes
+#include <atomic>
 
 // Forward declarations
 class TransientMultiApp;
@@ -48,11 +52,16 @@ public:
 
   virtual void resetApp(unsigned int global_app, Real time) override;
 
+  virtual bool isLoadBalanced() const override { return _load_balance_interval > 0; }
+
   /**
    * Finds the smallest dt from among any of the apps.
    */
   Real computeDT();
 
+protected:
+  virtual void setupRedistributedApp(unsigned int i) override;
+
 private:
   /**
    * Setup the executioner for the local app.
@@ -62,6 +71,20 @@ private:
    */
   void setupApp(unsigned int i, Real time = 0.0);
 
+  /**
+   * Solve a local app up to the target time.  This may run concurrently for several apps.
+   *
+   * @param i The local app number
+   * @param dt The master time step
+   * @param target_time The global time the app is solved to
+   * @param auto_advance Whether or not to advance the app at the end of the solve
+   */
+  void solveApp(unsigned int i, Real dt, Real target_time, bool auto_advance);
+
+  /// Write a line to the console of this MultiApp from any of the threads solving the apps
+  template <typename... Args>
+  void consoleMessage(Args &&... args);
+
   std::vector<Transient *> _transient_executioners;
 
   bool _sub_cycling;
@@ -73,7 +96,8 @@ private:
   unsigned int _max_failures;
   bool _tolerate_failure;
 
-  unsigned int _failures;
+  /// The number of failed sub-cycles, which may be counted on several threads
+  std::atomic<unsigned int> _failures;
 
   bool _catch_up;
   Real _max_catch_up_steps;
@@ -86,9 +110,6 @@ private:
   /// The variables that have been transferred to.  Used when doing transfer interpolation.  This will be cleared after each solve.
   std::vector<std::string> _transferred_vars;
 
-  /// The DoFs associated with all of the currently transferred variables.
-  std::set<dof_id_type> _transferred_dofs;
-
   std::vector<std::map<std::string, unsigned int>> _output_file_numbers;
 
   bool _auto_advance;
@@ -98,8 +119,23 @@ private:
   /// Flag for toggling console output on sub cycles
   bool _print_sub_cycles;
 
+  /// Serializes the console output of apps solved concurrently
+  Threads::spin_mutex _console_mutex;
+
   /// The solution from the end of the previous solve, this is cloned from the Nonlinear solution during restore
   std::vector<std::unique_ptr<NumericVector<Real>>> _end_solutions;
+
+  /// The number of time steps between balancing the Apps over the processors (0 disables it)
+  const unsigned int _load_balance_interval;
+
+  /// The relative improvement of the largest processor cost required to move Apps
+  const Real _load_balance_tolerance;
+
+  /// The number of time steps since the Apps were last balanced
+  unsigned int _steps_since_load_balance;
+
+  /// The wall time spent solving each local App since the Apps were last balanced
+  std::vector<Real> _app_solve_times;
 };
 
 /**
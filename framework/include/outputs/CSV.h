@@ -49,6 +49,11 @@ protected:
    */
   virtual std::string filename() override;
 
+  /**
+   * Append to the existing CSV file, see FileOutput::appendToFiles()
+   */
+  virtual void appendToFiles() override;
+
   /**
    * Setup the CSV output
    * If restarting and the append_restart flag is false, then the output data is cleared here
@@ -15,6 +15,7 @@
 #include "RestartableDataIO.h"
 
 #include <deque>
+#include <future>
 
 // Forward declarations
 class Checkpoint;
@@ -36,6 +37,12 @@ struct CheckpointFileNames
 
   /// Filename for restartable data filename
   std::string restart;
+
+  /// Filename for the snapshot of the system vectors of asynchronous checkpoints
+  std::string system_data;
+
+  /// Filename for the single file of shared checkpoints
+  std::string shared;
 };
 
 /**
@@ -50,6 +57,11 @@ public:
    */
   Checkpoint(const InputParameters & parameters);
 
+  /**
+   * Waits for a checkpoint that is still being written asynchronously, without committing it
+   */
+  virtual ~Checkpoint();
+
   /**
    * Returns the base filename for the checkpoint files
    */
@@ -61,6 +73,12 @@ public:
    */
   std::string directory();
 
+  /**
+   * Moves a checkpoint written asynchronously into place once it is complete before
+   * performing the output.
+   */
+  virtual void outputStep(const ExecFlagType & type) override;
+
 protected:
   /**
    * Outputs a checkpoint file.
@@ -71,6 +89,23 @@ protected:
 private:
   void updateCheckpointFiles(CheckpointFileNames file_struct);
 
+  /**
+   * The names of the checkpoint files with the given base name
+   */
+  CheckpointFileNames checkpointFileNames(const std::string & base) const;
+
+  /**
+   * The directory that asynchronous checkpoints are written into until they are complete
+   */
+  std::string pendingDirectory();
+
+  /**
+   * Moves the files of the asynchronously written checkpoint from the pending directory into the
+   * checkpoint directory if all processors have finished writing them. Collective.
+   * @param wait Whether to wait for the write to finish
+   */
+  void commitCheckpoint(bool wait);
+
   /// Max no. of output files to store
   unsigned int _num_files;
 
@@ -83,6 +118,12 @@ private:
   /// True if running with parallel mesh
   bool _parallel_mesh;
 
+  /// True if each checkpoint is written into a single file shared by all processors
+  const bool _shared_file;
+
+  /// True if the restartable data is written in the background while the simulation continues
+  const bool _async;
+
   /// Reference to the restartable data
   const RestartableDatas & _restartable_data;
 
@@ -100,6 +141,15 @@ private:
 
   /// Vector of checkpoint filename structures
   std::deque<CheckpointFileNames> _file_names;
+
+  /// The background write of the system and restartable data of the pending checkpoint
+  std::future<void> _async_write;
+
+  /// The files of the pending checkpoint in the pending directory
+  CheckpointFileNames _pending_file_struct;
+
+  /// The files of the pending checkpoint once they are moved into the checkpoint directory
+  CheckpointFileNames _async_file_struct;
 };
 
 #endif // CHECKPOINT_H
@@ -52,6 +52,11 @@ public:
    */
   virtual void meshChanged() override;
 
+  /**
+   * Append to the existing ExodusII file, see FileOutput::appendToFiles()
+   */
+  virtual void appendToFiles() override;
+
   /**
    * Performs the necessary deletion and re-creating of ExodusII_IO object
    *
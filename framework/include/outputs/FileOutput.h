@@ -54,6 +54,14 @@ public:
    */
   unsigned int getFileNumber();
 
+  /**
+   * Continue the existing output files instead of starting new ones, as on recover.
+   *
+   * This method was implemented for the MultiApp system, particularly when an application is
+   * restored from a Backup on another processor after it was moved.
+   */
+  virtual void appendToFiles() {}
+
   /**
    * Returns the default output file base
    * @return The name of the input file with '_out' append to the end
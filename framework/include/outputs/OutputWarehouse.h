@@ -66,6 +66,13 @@ public:
    */
   void meshChanged();
 
+  /**
+   * Indicate that a MultiApp starts (stops) executing its Apps concurrently on threads. Output
+   * of all of the Apps in this process is serialized in between.
+   */
+  static void beginConcurrentApps();
+  static void endConcurrentApps();
+
   /**
    * Return the list of hidden variables for the given output name
    * @param output_name The name of the output object for which the variables should be returned
@@ -92,6 +99,11 @@ public:
    */
   std::map<std::string, unsigned int> getFileNumbers();
 
+  /**
+   * Calls the appendToFiles method for every FileOutput output object
+   */
+  void appendToFiles();
+
   /**
    * Stores the common InputParameters object
    * @param params_ptr A pointer to the common parameters object to be stored
@@ -36,12 +36,20 @@ protected:
    */
   virtual void output(const ExecFlagType & type) override;
 
+  /**
+   * Gather the timeline trace from all processors and write it on processor 0
+   */
+  void outputTrace();
+
   // Detail level
   unsigned int _level;
 
   bool _heaviest_branch;
 
   unsigned int _heaviest_sections;
+
+  /// The file to write the timeline trace to (empty when not tracing)
+  const FileName _trace_file;
 };
 
 #endif /* PERFGRAPHOUTPUT_H */
@@ -0,0 +1,64 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef HITCACHE_H
+#define HITCACHE_H
+
+#include "hit.h"
+
+// C++ includes
+#include <memory>
+#include <string>
+
+/**
+ * Binary files of the exploded hit trees of input files, so that later runs with the same input
+ * file do not have to parse it again.  A cache file is only used for the exact input text and
+ * build of the application it was written for: its name contains a hash of both and its header
+ * repeats the hash and the length of the input and the build id.
+ */
+namespace HitCache
+{
+/**
+ * The name of the cache file for an input file.
+ * @param directory The directory of the cache files
+ * @param filename The name of the input file
+ * @param input The text of the input file
+ * @param build_id Identifies the build of the application
+ */
+std::string cacheFileName(const std::string & directory,
+                          const std::string & filename,
+                          const std::string & input,
+                          const std::string & build_id);
+
+/**
+ * Read the tree cached for an input file.
+ * @param cache_file The name of the cache file
+ * @param input The text of the input file
+ * @param build_id Identifies the build of the application
+ * @return The tree, or nullptr if there is no cache file for this input text and build
+ */
+std::unique_ptr<hit::Node>
+read(const std::string & cache_file, const std::string & input, const std::string & build_id);
+
+/**
+ * Write the tree parsed from an input file to a cache file.  The file is written under a
+ * temporary name and renamed, so that processes reading it never see a partial file.
+ * @param cache_file The name of the cache file
+ * @param input The text of the input file
+ * @param build_id Identifies the build of the application
+ * @param root The exploded tree parsed from input
+ * @return Whether the file was written
+ */
+bool write(const std::string & cache_file,
+           const std::string & input,
+           const std::string & build_id,
+           hit::Node * root);
+}
+
+#endif // HITCACHE_H
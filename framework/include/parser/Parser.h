@@ -12,6 +12,7 @@
 
 // MOOSE includes
 #include "ConsoleStreamInterface.h"
+#include "PerfGraphInterface.h"
 #include "MooseTypes.h"
 #include "InputParameters.h"
 #include "Syntax.h"
@@ -112,7 +113,7 @@ private:
  * parsing files. It is not currently designed for extensibility. If you wish to build your own
  * parser, please contact the MOOSE team for guidance.
  */
-class Parser : public ConsoleStreamInterface, public hit::Walker
+class Parser : public ConsoleStreamInterface, public hit::Walker, public PerfGraphInterface
 {
 public:
   enum SyntaxFormatterType
@@ -281,6 +282,13 @@ protected:
   /// The current stream object used for capturing errors during extraction
   std::ostringstream * _current_error_stream;
 
+  /// Timers
+  PerfID _parse_timer;
+  PerfID _read_input_file_timer;
+  PerfID _check_input_timer;
+  PerfID _extract_params_timer;
+  PerfID _error_check_timer;
+
 private:
   std::string _errmsg;
   std::string _warnmsg;
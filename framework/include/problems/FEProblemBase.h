@@ -1010,6 +1010,29 @@ public:
    */
   virtual void computeResidualTags(const std::set<TagID> & tags);
 
+  /**
+   * Form the residual and the Jacobian together with default tags. Every element is visited once,
+   * which saves the second reinit and material evaluation. It is called by Libmesh through
+   * ComputeResidualAndJacobianFunctor; the following call to computeJacobianSys() for the same
+   * solution then reuses the Jacobian formed here.
+   */
+  virtual void computeResidualAndJacobian(const NumericVector<Number> & soln,
+                                          NumericVector<Number> & residual,
+                                          SparseMatrix<Number> & jacobian);
+
+  /**
+   * Whether the next residual evaluation of the nonlinear solver will be followed by a Jacobian
+   * evaluation at the same solution, i.e. it is not a trial point of a line search
+   */
+  bool residualFollowedByJacobian() const { return _residual_followed_by_jacobian; }
+
+  /**
+   * Form the residual vectors and matrices for the given tags together. It should not be called
+   * directly by users.
+   */
+  virtual void computeResidualAndJacobianTags(const std::set<TagID> & vector_tags,
+                                              const std::set<TagID> & matrix_tags);
+
   /**
    * Form a Jacobian matrix. It is called by Libmesh.
    */
@@ -1040,6 +1063,27 @@ public:
    */
   virtual void computeJacobianTags(const std::set<TagID> & tags);
 
+  /**
+   * Prepare applying the Jacobian at \p soln without assembling it (MATRIX_FREE solve type).
+   * Executes everything that precedes the element loops of computeJacobian() once, so that the
+   * following calls to computeJacobianAction() only need to visit the elements.
+   */
+  virtual void setupJacobianAction(const NumericVector<Number> & soln);
+
+  /**
+   * Compute y = J x from the element Jacobians, without assembling J, at the solution passed to
+   * setupJacobianAction(). If \p x is nullptr, the diagonal of J is computed instead.
+   *
+   * @param x The vector the Jacobian is applied to
+   * @param y The result
+   * @param jacobian The matrix standing in for the unallocated system matrix (the shell matrix). It
+   * is associated with the system matrix tag, so that objects cache their contributions as usual,
+   * but it is neither assembled nor modified.
+   */
+  virtual void computeJacobianAction(const NumericVector<Number> * x,
+                                     NumericVector<Number> & y,
+                                     SparseMatrix<Number> & jacobian);
+
   /**
    * Computes several Jacobian blocks simultaneously, summing their contributions into smaller
    * preconditioning matrices.
@@ -1489,6 +1533,12 @@ protected:
   /// Create extra tagged vectors and matrices
   void createTagVectors();
 
+  /**
+   * Execute everything that precedes the element loops of a Jacobian evaluation: the transfers,
+   * MultiApps, UserObjects, AuxKernels and Controls on EXEC_NONLINEAR.
+   */
+  void prepareJacobian();
+
   MooseMesh & _mesh;
   EquationSystems _eq;
   bool _initialized;
@@ -1678,6 +1728,12 @@ protected:
   /// Indicates if the Jacobian was computed
   bool _has_jacobian;
 
+  /// Indicates that the Jacobian for the current solution was formed together with the residual
+  bool _jacobian_formed_with_residual;
+
+  /// Indicates that the next residual evaluation of the solver is followed by a Jacobian evaluation
+  bool _residual_followed_by_jacobian;
+
   /// Indicates that we need to compute variable values for previous Newton iteration
   bool _needs_old_newton_iter;
 
@@ -1735,6 +1791,9 @@ private:
   const bool _force_restart;
   const bool _skip_additional_restart_data;
   const bool _skip_nl_system_check;
+
+  /// Whether or not the Assembly objects cache the volume shape functions
+  const bool _cache_fe_shapes;
   bool _fail_next_linear_convergence_check;
 
   /// At or beyond initialSteup stage
@@ -1772,7 +1831,11 @@ private:
   const PerfID _compute_residual_tags_timer;
   const PerfID _compute_jacobian_internal_timer;
   const PerfID _compute_jacobian_tags_timer;
+  const PerfID _compute_residual_and_jacobian_timer;
+  const PerfID _compute_residual_and_jacobian_tags_timer;
   const PerfID _compute_jacobian_blocks_timer;
+  const PerfID _setup_jacobian_action_timer;
+  const PerfID _compute_jacobian_action_timer;
   const PerfID _compute_bounds_timer;
   const PerfID _compute_post_check_timer;
   const PerfID _compute_damping_timer;
@@ -22,6 +22,7 @@
 // Forward declarations
 class Backup;
 class FEProblemBase;
+class SystemBase;
 
 /**
  * Class for doing restart.
@@ -42,6 +43,44 @@ public:
                             const RestartableDatas & restartable_datas,
                             std::set<std::string> & _recoverable_data);
 
+  /**
+   * Write out the restartable data previously stored in a Backup by createBackup().
+   * Only writes files, so that it may be called from a thread other than the one running the
+   * simulation.
+   */
+  void writeRestartableData(const std::string & base_file_name, const Backup & backup) const;
+
+  /**
+   * Write out the local part of the system vectors previously stored in a Backup by
+   * createBackup() into a file per processor.  Only writes files, like the above.
+   */
+  void writeSystemData(const std::string & base_file_name, const Backup & backup) const;
+
+  /**
+   * Read the system vectors written by writeSystemData(), which requires the same number of
+   * processors and the same system vectors as the simulation that wrote them.
+   * @return Whether or not the files exist.  Collective.
+   */
+  bool readSystemData(const std::string & base_file_name);
+
+  /**
+   * Write a checkpoint into a single file shared by all processors with collective MPI-IO, see
+   * SharedCheckpointIO: the mesh, the system vectors and the restartable data of all processors
+   * and threads.  The mesh and the system vectors are stored by global ids.
+   */
+  void writeSharedCheckpoint(const std::string & file_name,
+                             const RestartableDatas & restartable_datas);
+
+  /**
+   * Read the system vectors from a file written by writeSharedCheckpoint() and the restartable
+   * data to be restored by readRestartableData().  Every processor reads its own blocks if they
+   * hold all the degrees of freedom it owns now.  Otherwise it reads the values of its degrees of
+   * freedom from the blocks of all processors, the stateful material properties of its elements
+   * from the restartable data of all processors and the rest of the restartable data from the
+   * first processor.  Collective.
+   */
+  void readSharedCheckpoint(const std::string & file_name);
+
   /**
    * Read restartable data header to verify that we are restarting on the correct number of
    * processors and threads.
@@ -65,6 +104,16 @@ public:
   void restoreBackup(std::shared_ptr<Backup> backup, bool for_restart = false);
 
 private:
+  /**
+   * The name of the restartable data file of this processor and the given thread
+   */
+  std::string restartableDataFileName(const std::string & base_file_name, THREAD_ID tid) const;
+
+  /**
+   * The name of the system data file of this processor
+   */
+  std::string systemDataFileName(const std::string & base_file_name) const;
+
   /**
    * Serializes the data into the stream object.
    */
@@ -74,11 +123,40 @@ private:
 
   /**
    * Deserializes the data from the stream object.
+   * @param distributed_only Only read the stateful material properties, which are merged from the
+   * data of several processors
    */
   void deserializeRestartableData(
       const std::map<std::string, std::unique_ptr<RestartableDataValue>> & restartable_data,
       std::istream & stream,
-      const std::set<std::string> & recoverable_data);
+      const std::set<std::string> & recoverable_data,
+      bool distributed_only = false);
+
+  /**
+   * Read the header of the restartable data of one processor and thread and check it against the
+   * current simulation.
+   * @param check_parallel Whether the data must have been written on the same number of
+   * processors and threads
+   */
+  void readHeader(std::istream & stream, bool check_parallel = true);
+
+  /**
+   * Serializes the vectors of a System by the global ids of the nodes and elements of the degrees
+   * of freedom owned by this processor
+   */
+  void serializeSharedSystem(SystemBase & system_base, std::ostream & stream);
+
+  /**
+   * Deserializes vectors stored by serializeSharedSystem() on any processor into the degrees of
+   * freedom owned by this processor.  The vectors need to be closed afterwards.
+   * @return The number of degrees of freedom set
+   */
+  dof_id_type deserializeSharedSystem(SystemBase & system_base, std::istream & stream);
+
+  /**
+   * Closes the vectors of a System set by deserializeSharedSystem() and updates the System
+   */
+  void closeSharedSystem(SystemBase & system_base);
 
   /**
    * Serializes the data for the Systems in FEProblemBase
@@ -93,8 +171,11 @@ private:
   /// Reference to a FEProblemBase being restarted
   FEProblemBase & _fe_problem;
 
-  /// A vector of file handles, one per thread
-  std::vector<std::shared_ptr<std::ifstream>> _in_file_handles;
+  /// The stream to read for each thread
+  std::vector<std::shared_ptr<std::istream>> _in_streams;
+
+  /// The streams of other processors to read the stateful material properties from for each thread
+  std::vector<std::vector<std::shared_ptr<std::istream>>> _distributed_streams;
 };
 
 #endif /* RESTARTABLEDATAIO_H */
@@ -70,6 +70,7 @@ protected:
 
   static const std::string MAT_PROP_EXT;
   static const std::string RESTARTABLE_DATA_EXT;
+  static const std::string SYSTEM_DATA_EXT;
 };
 
 #endif /* RESURRECTOR_H */
@@ -0,0 +1,115 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef SHAREDCHECKPOINTIO_H
+#define SHAREDCHECKPOINTIO_H
+
+// MOOSE includes
+#include "MooseTypes.h"
+
+#include "libmesh/parallel.h"
+
+// C++ includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Forward declarations
+namespace libMesh
+{
+class MeshBase;
+}
+
+/**
+ * A checkpoint written into a single file shared by all processors with collective MPI-IO.
+ *
+ * Every processor writes the same number of blocks: the part of the mesh it owns, the values of
+ * the degrees of freedom it owns and its restartable data of every thread.  The file starts with
+ * an index of the offsets of the blocks of all processors, so that a reader finds the blocks of any
+ * processor.  The mesh and the degrees of freedom are stored by global ids, so the file can be read
+ * on any number of processors.
+ */
+class SharedCheckpointIO
+{
+public:
+  /// The extension of shared checkpoint files
+  static const std::string FILE_EXT;
+
+  /// The blocks of each processor, followed by the restartable data of each thread
+  enum Block
+  {
+    MESH_BLOCK = 0,
+    SYSTEMS_BLOCK = 1,
+    RESTARTABLE_DATA_BLOCK = 2
+  };
+
+  /**
+   * Write the blocks of all processors into a file.  Collective.
+   * @param blocks The blocks of this processor, the same number on all processors
+   */
+  static void write(const Parallel::Communicator & comm,
+                    const std::string & file_name,
+                    const std::vector<std::string> & blocks);
+
+  /**
+   * Serialize the part of a mesh owned by this processor into a block.  Adapted meshes are not
+   * supported.  Collective.
+   */
+  static std::string serializeMesh(const MeshBase & mesh);
+
+  /**
+   * Open a file written by write() and read its index.  Collective.
+   */
+  SharedCheckpointIO(const Parallel::Communicator & comm, const std::string & file_name);
+
+  /**
+   * Close the file.  Collective.
+   */
+  ~SharedCheckpointIO();
+
+  /**
+   * The number of processors that wrote the file
+   */
+  processor_id_type nProcs() const { return _n_procs; }
+
+  /**
+   * The number of threads the restartable data was written for
+   */
+  unsigned int nThreads() const { return _n_blocks - RESTARTABLE_DATA_BLOCK; }
+
+  /**
+   * Read a block written by a processor.  Not collective, every processor may read any blocks.
+   */
+  std::string read(processor_id_type proc_id, unsigned int block) const;
+
+  /**
+   * Build a mesh from the mesh blocks of all processors.  On the number of processors the file
+   * was written on the partitioning of the file is kept, otherwise the mesh is partitioned.
+   * Collective.
+   */
+  void readMesh(MeshBase & mesh) const;
+
+private:
+  /// The name of the file
+  const std::string _file_name;
+
+  /// The file handle
+  MPI_File _fh;
+
+  /// The number of processors that wrote the file
+  processor_id_type _n_procs;
+
+  /// The number of blocks of each processor
+  unsigned int _n_blocks;
+
+  /// The offsets of all blocks in the file, followed by the end of the file
+  std::vector<std::uint64_t> _offsets;
+};
+
+#endif /* SHAREDCHECKPOINTIO_H */
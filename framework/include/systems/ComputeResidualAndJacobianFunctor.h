@@ -0,0 +1,37 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef COMPUTERESIDUALANDJACOBIANFUNCTOR_H
+#define COMPUTERESIDUALANDJACOBIANFUNCTOR_H
+
+#include "libmesh/nonlinear_implicit_system.h"
+
+using namespace libMesh;
+
+class FEProblemBase;
+
+/**
+ * Residual callback that forms the system matrix at the same time as the residual. The Jacobian
+ * callback that PETSc issues next for the same solution then has nothing left to do. Residuals
+ * at line search trial points, which are not followed by a Jacobian, are formed alone.
+ */
+class ComputeResidualAndJacobianFunctor : public NonlinearImplicitSystem::ComputeResidual
+{
+private:
+  FEProblemBase & _fe_problem;
+
+public:
+  ComputeResidualAndJacobianFunctor(FEProblemBase & fe_problem);
+
+  void residual(const NumericVector<Number> & soln,
+                NumericVector<Number> & residual,
+                NonlinearImplicitSystem & sys) override;
+};
+
+#endif
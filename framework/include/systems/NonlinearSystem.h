@@ -13,6 +13,7 @@
 #include "NonlinearSystemBase.h"
 #include "ComputeResidualFunctor.h"
 #include "ComputeFDResidualFunctor.h"
+#include "ComputeResidualAndJacobianFunctor.h"
 
 /**
  * Nonlinear system to be solved
@@ -70,10 +71,24 @@ public:
 
   virtual TransientNonlinearImplicitSystem & sys() { return _transient_sys; }
 
+#ifdef LIBMESH_HAVE_PETSC
+  /**
+   * Prepare the matrix-free Jacobian (MATRIX_FREE solve type) at the solution \p x. Called by
+   * PETSc once per Newton step, instead of forming the Jacobian.
+   */
+  void updateMatrixFreeJacobian(Vec x);
+
+  /**
+   * Apply the matrix-free Jacobian, y = J x. If \p x is nullptr, the diagonal of J is put in \p y.
+   */
+  void applyMatrixFreeJacobian(Vec x, Vec y);
+#endif
+
 protected:
   TransientNonlinearImplicitSystem & _transient_sys;
   ComputeResidualFunctor _nl_residual_functor;
   ComputeFDResidualFunctor _fd_residual_functor;
+  ComputeResidualAndJacobianFunctor _resid_and_jac_functor;
 
 private:
   /**
@@ -95,7 +110,19 @@ private:
    */
   void setupColoringFiniteDifferencedPreconditioner();
 
+  /**
+   * Hand PETSc a shell matrix that applies the element Jacobians to a vector instead of the
+   * assembled Jacobian (MATRIX_FREE solve type). The system matrix is neither allocated nor
+   * assembled in this mode.
+   */
+  void setupMatrixFreeJacobian();
+
   bool _use_coloring_finite_difference;
+
+#ifdef LIBMESH_HAVE_PETSC
+  /// Shell matrix of the MATRIX_FREE solve type
+  Mat _matrix_free_jacobian;
+#endif
 };
 
 #endif /* NONLINEARSYSTEM_H */
@@ -284,6 +284,21 @@ public:
    */
   void computeJacobianTags(const std::set<TagID> & tags);
 
+  /**
+   * Form the tag-associated residual vectors and Jacobian matrices together, visiting every
+   * element only once
+   * @param vector_tags The tags of the residual vectors to form
+   * @param matrix_tags The tags of the matrices to form
+   */
+  void computeResidualAndJacobianTags(const std::set<TagID> & vector_tags,
+                                      const std::set<TagID> & matrix_tags);
+
+  /**
+   * Whether the nonlinear solver should request the residual and the Jacobian together
+   */
+  void setResidualAndJacobianTogether(bool state) { _residual_and_jacobian_together = state; }
+  bool residualAndJacobianTogether() const { return _residual_and_jacobian_together; }
+
   /**
    * Associate jacobian to systemMatrixTag, and then form a matrix for all the tags
    */
@@ -294,6 +309,13 @@ public:
    */
   void computeJacobian(SparseMatrix<Number> & jacobian);
 
+  /**
+   * Compute y = J x by applying the element Jacobians of the kernels, the integrated BCs and the
+   * NodalBCs to \p x, without assembling J (see the MATRIX_FREE solve type). If \p x is nullptr,
+   * the diagonal of J is computed instead.
+   */
+  void computeJacobianAction(const NumericVector<Number> * x, NumericVector<Number> & y);
+
   /**
    * Computes several Jacobian blocks simultaneously, summing their contributions into smaller
    * preconditioning matrices.
@@ -591,12 +613,28 @@ public:
   bool _compute_initial_residual_before_preset_bcs;
 
 protected:
+  /**
+   * Call the residualSetup() method of all residual objects
+   */
+  virtual void residualSetup();
+
+  /**
+   * Call the jacobianSetup() method of all residual objects
+   */
+  virtual void jacobianSetup();
+
   /**
    * Compute the residual for a given tag
    * @param tags The tags of kernels for which the residual is to be computed.
    */
   void computeResidualInternal(const std::set<TagID> & tags);
 
+  /**
+   * Residual contributions that are not formed in the element loop (scalar kernels, nodal
+   * kernels, Dirac kernels and constraints)
+   */
+  void computeNonElementalResiduals(const std::set<TagID> & tags);
+
   /**
    * Enforces nodal boundary conditions. The boundary condition will be implemented
    * in the residual using all the tags in the system.
@@ -618,6 +656,30 @@ protected:
    */
   void computeJacobianInternal(const std::set<TagID> & tags);
 
+  /**
+   * Jacobian contributions that are not formed in the element loop (nodal kernels, Dirac kernels,
+   * scalar kernels, constraints and nodal BCs)
+   */
+  void computeNonElementalJacobians(const std::set<TagID> & tags);
+
+  /**
+   * Compute the Jacobian entries of the NodalBCs for the given tags and cache them on the Assembly
+   * of thread 0 (see Assembly::cacheJacobianContribution())
+   */
+  void cacheNodalBCsJacobian(const std::set<TagID> & tags);
+
+  /**
+   * Activate the tagged matrices and set the PETSc options needed for assembling into them
+   */
+  void prepareTaggedMatrices(const std::set<TagID> & tags);
+
+  /**
+   * Form the residual vectors and the matrices for the given tags. Users should not call this func
+   * directly.
+   */
+  void computeResidualAndJacobianInternal(const std::set<TagID> & vector_tags,
+                                          const std::set<TagID> & matrix_tags);
+
   void computeDiracContributions(bool is_jacobian);
 
   void computeScalarKernelsJacobians();
@@ -632,6 +694,8 @@ protected:
   const NumericVector<Number> * _current_solution;
   /// ghosted form of the residual
   NumericVector<Number> * _residual_ghosted;
+  /// ghosted copy of the vector the Jacobian is applied to in computeJacobianAction()
+  NumericVector<Number> * _jacobian_action_x;
 
   /// Serialized version of the solution vector
   NumericVector<Number> & _serialized_solution;
@@ -786,6 +850,9 @@ protected:
   /// If there is a nodal BC having diag_save_in
   bool _has_nodalbc_diag_save_in;
 
+  /// Whether the nonlinear solver forms the residual and the Jacobian together
+  bool _residual_and_jacobian_together;
+
   void getNodeDofs(dof_id_type node_id, std::vector<dof_id_type> & dofs);
 
   std::vector<dof_id_type> _var_all_dof_indices;
@@ -799,6 +866,8 @@ protected:
   PerfID _nodal_kernel_bcs_timer;
   PerfID _nodal_bcs_timer;
   PerfID _compute_jacobian_tags_timer;
+  PerfID _compute_residual_and_jacobian_tags_timer;
+  PerfID _compute_residual_and_jacobian_internal_timer;
   PerfID _compute_jacobian_blocks_timer;
   PerfID _compute_dampers_timer;
   PerfID _compute_dirac_timer;
@@ -12,6 +12,7 @@
 
 // MOOSE includes
 #include "MultiAppTransfer.h"
+#include "KDTree.h"
 
 // Forward declarations
 class MultiAppNearestNodeTransfer;
@@ -50,17 +51,42 @@ protected:
    * @return The maximum distance between the point p and the eight corners of
    * the bounding box bbox.
    */
-  Real bboxMaxDistance(Point p, BoundingBox bbox);
+  Real bboxMaxDistance(const Point & p, const BoundingBox & bbox);
 
   /**
-   * Return the distance between the given point and the nearest corner of the
+   * Return the distance between the given point and the nearest point of the
    * given bounding box.
    * @param p The point to evaluate all distances from.
    * @param bbox The bounding box to evaluate the distance to.
-   * @return The minimum distance between the point p and the eight corners of
-   * the bounding box bbox.
+   * @return The minimum distance between the point p and the bounding box
+   * bbox, zero if p is inside of it.
    */
-  Real bboxMinDistance(Point p, BoundingBox bbox);
+  Real bboxMinDistance(const Point & p, const BoundingBox & bbox);
+
+  /**
+   * Collect the local nodes of every local "from" domain that have a dof of the
+   * source variable.
+   * @param source_points The positions of the nodes (translated by the position
+   * of the domain) for each local "from" domain
+   * @param source_dofs The dof of the source variable at each of these nodes
+   */
+  void getLocalSourceNodes(std::vector<std::vector<Point>> & source_points,
+                           std::vector<std::vector<dof_id_type>> & source_dofs);
+
+  /**
+   * Gather the bounding boxes of the source nodes of all "from" domains and
+   * build the KDTree of their centers used by getCandidateProcessors().
+   */
+  void buildSourceBoundingBoxes(const std::vector<std::vector<Point>> & source_points,
+                                const std::vector<unsigned int> & froms_per_proc);
+
+  /**
+   * Find the processors owning a "from" domain that may contain the nearest
+   * source node of the given point.
+   * @param p The target point
+   * @param procs The processors, sorted and without duplicates
+   */
+  void getCandidateProcessors(const Point & p, std::vector<processor_id_type> & procs);
 
   void getLocalNodes(MooseMesh * mesh, std::vector<Node *> & local_nodes);
 
@@ -82,6 +108,28 @@ protected:
   std::vector<std::vector<dof_id_type>> & _cached_dof_ids;
   std::map<dof_id_type, unsigned int> & _cached_from_inds;
   std::map<dof_id_type, unsigned int> & _cached_qp_inds;
+
+  /// Bounding boxes of the source nodes of all "from" domains
+  std::vector<BoundingBox> _source_bboxes;
+
+  /// The processor owning each "from" domain
+  std::vector<processor_id_type> _source_bbox_procs;
+
+  /// Centers of the non-empty source bounding boxes
+  std::vector<Point> _source_bbox_centers;
+
+  /// The "from" domain of each center
+  std::vector<unsigned int> _source_bbox_froms;
+
+  /// Largest distance between the center and the corners of a source bounding box
+  Real _max_source_bbox_radius;
+
+  /// KDTree of the bounding box centers
+  std::unique_ptr<KDTree> _source_bbox_tree;
+
+  /// Buffers for the bounding box searches
+  std::vector<std::size_t> _bbox_search_index;
+  std::vector<std::pair<std::size_t, Real>> _bbox_search_result;
 };
 
 #endif /* MULTIAPPNEARESTNODETRANSFER_H */
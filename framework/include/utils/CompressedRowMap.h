@@ -0,0 +1,193 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef COMPRESSEDROWMAP_H
+#define COMPRESSEDROWMAP_H
+
+#include "MooseError.h"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+#include <vector>
+
+/**
+ * A read-only map from integer keys to lists of values stored in compressed sparse row form:
+ * the sorted keys with the ranges of their rows and the values of all rows in two contiguous
+ * arrays. This replaces a std::map<Key, std::vector<Value>> with two allocations, and a
+ * lookup is a direct index for keys in the contiguous leading range of the keys (e.g. the
+ * node ids of a replicated mesh) and a binary search in the flat key array otherwise.
+ *
+ * The interface follows the one of std::map where it is used for lookups: find() returns an
+ * iterator to a pair of the key and the Row of values.  A few keys can be added with insert()
+ * after the map was built; they are kept in a tree and are not visited when iterating.
+ */
+template <typename Key, typename Value>
+class CompressedRowMap
+{
+public:
+  /// The values of one key, which behave like a const std::vector<Value>
+  class Row
+  {
+  public:
+    typedef const Value * const_iterator;
+
+    Row() : _begin(nullptr), _end(nullptr) {}
+    Row(const Value * begin, const Value * end) : _begin(begin), _end(end) {}
+
+    const_iterator begin() const { return _begin; }
+    const_iterator end() const { return _end; }
+    std::size_t size() const { return _end - _begin; }
+    bool empty() const { return _begin == _end; }
+    const Value & operator[](std::size_t i) const { return _begin[i]; }
+    const Value & front() const { return *_begin; }
+    const Value & back() const { return *(_end - 1); }
+
+  private:
+    const Value * _begin;
+    const Value * _end;
+  };
+
+  typedef std::pair<Key, Row> value_type;
+  typedef const value_type * const_iterator;
+
+  CompressedRowMap() : _dense_size(0) {}
+
+  /// The rows point into _values, so the map can be moved but not copied
+  CompressedRowMap(const CompressedRowMap &) = delete;
+  CompressedRowMap & operator=(const CompressedRowMap &) = delete;
+  CompressedRowMap(CompressedRowMap &&) = default;
+  CompressedRowMap & operator=(CompressedRowMap &&) = default;
+
+  /**
+   * Build the map from (key, value) pairs sorted by key.  The values of a key keep the order of
+   * the pairs.  Keys added with insert() are kept.
+   */
+  void build(const std::vector<std::pair<Key, Value>> & sorted_pairs)
+  {
+    std::vector<value_type>().swap(_entries);
+    std::vector<Value>().swap(_values);
+    _dense_size = 0;
+
+    // The values are stored first, the rows can only point to them once they do not move anymore
+    std::vector<std::size_t> offsets;
+    _values.reserve(sorted_pairs.size());
+    for (const auto & pair : sorted_pairs)
+    {
+      if (_entries.empty() || pair.first != _entries.back().first)
+      {
+        mooseAssert(_entries.empty() || pair.first > _entries.back().first, "Unsorted keys");
+        _entries.emplace_back(pair.first, Row());
+        offsets.push_back(_values.size());
+      }
+      _values.push_back(pair.second);
+    }
+    offsets.push_back(_values.size());
+    _entries.shrink_to_fit();
+
+    for (std::size_t i = 0; i < _entries.size(); ++i)
+      _entries[i].second = Row(_values.data() + offsets[i], _values.data() + offsets[i + 1]);
+
+    // Length of the leading range of consecutive keys that are looked up by index
+    while (_dense_size < _entries.size() &&
+           _entries[_dense_size].first == _entries[0].first + _dense_size)
+      ++_dense_size;
+  }
+
+  /**
+   * Append value to the values of a key that is not in the built part of the map.  This is meant
+   * for a small number of keys, e.g. nodes added to a mesh after the map was built.
+   */
+  void insert(const Key & key, const Value & value)
+  {
+    mooseAssert(findBuilt(key) == end(), "Key is in the built part of the CompressedRowMap");
+
+    auto & extra_row = _extra_rows[key];
+    extra_row.values.push_back(value);
+    extra_row.entry = value_type(
+        key, Row(extra_row.values.data(), extra_row.values.data() + extra_row.values.size()));
+  }
+
+  /// Remove all keys and values and release the memory
+  void clear()
+  {
+    std::vector<value_type>().swap(_entries);
+    std::vector<Value>().swap(_values);
+    _extra_rows.clear();
+    _dense_size = 0;
+  }
+
+  const_iterator begin() const { return _entries.data(); }
+  const_iterator end() const { return _entries.data() + _entries.size(); }
+
+  const_iterator find(const Key & key) const
+  {
+    auto it = findBuilt(key);
+    if (it == end() && !_extra_rows.empty())
+    {
+      auto extra_it = _extra_rows.find(key);
+      if (extra_it != _extra_rows.end())
+        return &extra_it->second.entry;
+    }
+    return it;
+  }
+
+  std::size_t count(const Key & key) const { return find(key) != end(); }
+
+  /// Number of keys
+  std::size_t size() const { return _entries.size() + _extra_rows.size(); }
+
+  bool empty() const { return size() == 0; }
+
+  /// The values of key, which must be in the map
+  const Row & at(const Key & key) const
+  {
+    auto it = find(key);
+    if (it == end())
+      mooseError("Key ", key, " not found in CompressedRowMap");
+    return it->second;
+  }
+
+private:
+  /// A key added with insert()
+  struct ExtraRow
+  {
+    value_type entry;
+    std::vector<Value> values;
+  };
+
+  /// Position of key in the built part of the map, or end()
+  const_iterator findBuilt(const Key & key) const
+  {
+    if (_dense_size && key >= _entries[0].first && key - _entries[0].first < _dense_size)
+      return begin() + (key - _entries[0].first);
+
+    auto it = std::lower_bound(
+        begin() + _dense_size, end(), key, [](const value_type & entry, const Key & k) {
+          return entry.first < k;
+        });
+    if (it == end() || it->first != key)
+      return end();
+    return it;
+  }
+
+  /// The sorted keys and their rows
+  std::vector<value_type> _entries;
+
+  /// The values of all keys
+  std::vector<Value> _values;
+
+  /// The keys added with insert()
+  std::map<Key, ExtraRow> _extra_rows;
+
+  /// The first _dense_size keys are consecutive
+  std::size_t _dense_size;
+};
+
+#endif // COMPRESSEDROWMAP_H
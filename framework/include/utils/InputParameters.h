@@ -54,6 +54,7 @@ class InputParameters : public Parameters
 {
 public:
   InputParameters(const InputParameters & rhs);
+  InputParameters(InputParameters && rhs);
   InputParameters(const Parameters & rhs);
 
   virtual ~InputParameters() = default;
@@ -491,6 +492,7 @@ public:
   using Parameters::operator=;
   using Parameters::operator+=;
   InputParameters & operator=(const InputParameters & rhs);
+  InputParameters & operator=(InputParameters && rhs);
   InputParameters & operator+=(const InputParameters & rhs);
   ///@}
 
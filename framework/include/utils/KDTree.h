@@ -33,6 +33,26 @@ public:
                       std::vector<std::size_t> & return_index,
                       std::vector<Real> & return_dist_sqr);
 
+  /**
+   * Find the nearest point for each of the query points in one pass.
+   * @param query_points The points to search the nearest neighbor for
+   * @param return_index Index of the nearest point for each query point
+   * @param return_dist_sqr Squared distance to the nearest point for each query point
+   */
+  void neighborSearch(const std::vector<Point> & query_points,
+                      std::vector<std::size_t> & return_index,
+                      std::vector<Real> & return_dist_sqr);
+
+  /**
+   * Find all points within the given distance of the query point.
+   * @param query_point The point to search around
+   * @param radius The search radius (not squared)
+   * @param indices_dist_sqr Pairs of the index and squared distance of the points found
+   */
+  void radiusSearch(const Point & query_point,
+                    Real radius,
+                    std::vector<std::pair<std::size_t, Real>> & indices_dist_sqr);
+
   using KdTreeT = nanoflann::KDTreeSingleIndexAdaptor<
       nanoflann::L2_Simple_Adaptor<Real, PointListAdaptor<Point>>,
       PointListAdaptor<Point>,
@@ -148,6 +148,15 @@ public:
    */
   void shallowCopy(std::vector<T> & rhs);
 
+  /**
+   * Doesn't actually make a copy of the data.
+   *
+   * Makes _this_ object operate on the size entries starting at data, which it does _not_ own.
+   * Used to view a window of a larger array.  The same warnings as above apply, and in addition
+   * _this_ object must never be resized beyond size or released while it views the window.
+   */
+  void shallowCopy(T * data, const unsigned int size);
+
   /**
    * Actual operator=... really does make a copy of the data
    *
@@ -292,6 +301,15 @@ MooseArray<T>::shallowCopy(std::vector<T> & rhs)
   _allocated_size = rhs.size();
 }
 
+template <typename T>
+inline void
+MooseArray<T>::shallowCopy(T * data, const unsigned int size)
+{
+  _data = data;
+  _size = size;
+  _allocated_size = size;
+}
+
 template <typename T>
 inline MooseArray<T> &
 MooseArray<T>::operator=(const std::vector<T> & rhs)
@@ -277,11 +277,12 @@ enum MooseKSPNormType
  */
 enum SolveType
 {
-  ST_PJFNK,  ///< Preconditioned Jacobian-Free Newton Krylov
-  ST_JFNK,   ///< Jacobian-Free Newton Krylov
-  ST_NEWTON, ///< Full Newton Solve
-  ST_FD,     ///< Use finite differences to compute Jacobian
-  ST_LINEAR  ///< Solving a linear problem
+  ST_PJFNK,      ///< Preconditioned Jacobian-Free Newton Krylov
+  ST_JFNK,       ///< Jacobian-Free Newton Krylov
+  ST_NEWTON,     ///< Full Newton Solve
+  ST_FD,         ///< Use finite differences to compute Jacobian
+  ST_LINEAR,     ///< Solving a linear problem
+  ST_MATRIX_FREE ///< Newton with the Jacobian applied element by element instead of assembled
 };
 
 /**
@@ -25,6 +25,7 @@
 
 // Forward Declarations
 class InputParameters;
+class MaterialPropertyStorage;
 class ExecFlagEnum;
 
 namespace libMesh
@@ -289,15 +290,16 @@ bool relativeFuzzyLessThan(const libMesh::Real & var1,
 
 /**
  * Function to dump the contents of MaterialPropertyStorage for debugging purposes
- * @param props The storage item to dump, this should be
+ * @param storage The storage to dump the layout from
+ * @param props The stored data to dump, this should be
  * MaterialPropertyStorage.props()/propsOld()/propsOlder().
  *
  * Currently this only words for scalar material properties. Something to do as needed would be to
  * create a method in MaterialProperty
  * that may be overloaded to dump the type using template specialization.
  */
-void MaterialPropertyStorageDump(
-    const HashMap<const libMesh::Elem *, HashMap<unsigned int, MaterialProperties>> & props);
+void MaterialPropertyStorageDump(const MaterialPropertyStorage & storage,
+                                 const MaterialProperties & props);
 
 /**
  * Indents the supplied message given the prefix and color
@@ -13,12 +13,14 @@
 // MOOSE Includes
 #include "MooseTypes.h"
 #include "PerfNode.h"
+#include "PerfTraceBuffer.h"
 #include "IndirectSort.h"
 #include "ConsoleStream.h"
 #include "MooseError.h"
 
 // System Includes
 #include <array>
+#include <mutex>
 
 // Forward Declarations
 class PerfGuard;
@@ -64,6 +66,8 @@ public:
   /**
    * Registers a named section of code
    *
+   * Note: this may be called from any thread
+   *
    * @return The unique ID to use for that section
    */
   PerfID registerSection(const std::string & section_name, unsigned int level);
@@ -155,6 +159,62 @@ public:
    */
   void updateTiming();
 
+  /**
+   * Add to a named event counter (cache hits, etc.).  Counters are printed after the graph.
+   *
+   * Note: not thread safe, only call this from the master thread
+   */
+  void addToCounter(const std::string & counter_name, unsigned long int count)
+  {
+    _counters[counter_name] += count;
+  }
+
+  /**
+   * Get the value of a named event counter
+   */
+  unsigned long int getCounter(const std::string & counter_name) const;
+
+  /**
+   * Start recording every timed section into per-thread ring buffers for a timeline trace.
+   *
+   * Sections timed with PerfGuard go into the buffer of the master thread, sections timed with
+   * PerfTraceGuard into the buffer of the thread executing them.
+   *
+   * @param buffer_size The number of events kept per thread, older events are overwritten
+   */
+  void enableTrace(const std::size_t buffer_size);
+
+  /**
+   * Whether or not the timeline trace is being recorded
+   */
+  bool tracing() const { return _tracing; }
+
+  /**
+   * Record a section executed by thread tid into the trace.
+   *
+   * This does not lock: each thread only ever writes to its own buffer.
+   */
+  void recordTraceEvent(const THREAD_ID tid,
+                        const PerfID id,
+                        const std::chrono::time_point<std::chrono::steady_clock> start,
+                        const std::chrono::time_point<std::chrono::steady_clock> end)
+  {
+    mooseAssert(tid + 1 < _trace_buffers.size(), "Invalid thread id for the trace");
+    _trace_buffers[tid]->record(id, start, end);
+  }
+
+  /**
+   * The recorded events of this process, merged across the threads and sorted by start time, as
+   * a comma separated list of Chrome Trace Event Format JSON objects (viewable in
+   * chrome://tracing or Perfetto).  Sections that are still running are included up to now.
+   *
+   * Note: only call this when no threaded loop is running
+   *
+   * @param pid The process id to tag the events with (the MPI rank)
+   * @param num_dropped Set to the number of events that were overwritten in the buffers
+   */
+  std::string traceEvents(const processor_id_type pid, std::size_t & num_dropped);
+
 protected:
   typedef VariadicTable<std::string,
                         unsigned long int,
@@ -276,6 +336,25 @@ protected:
   /// Whether or not timing is active
   bool _active;
 
+  /// Named event counters
+  std::map<std::string, unsigned long int> _counters;
+
+  /// Protects the section maps when sections are registered from threads
+  std::mutex _section_mutex;
+
+  /// Whether or not the timeline trace is being recorded
+  bool _tracing;
+
+  /// When the trace was enabled, the trace timestamps are relative to this
+  std::chrono::time_point<std::chrono::steady_clock> _trace_start;
+
+  /// One trace buffer per thread, the last one is for the sections on the graph's stack
+  std::vector<std::unique_ptr<PerfTraceBuffer>> _trace_buffers;
+
+  /// The start times of the sections on the stack as recorded for the trace.  Kept separately
+  /// because updateTiming() resets the start times of the nodes.
+  std::array<std::chrono::time_point<std::chrono::steady_clock>, MAX_STACK_SIZE> _trace_stack;
+
   // Here so PerfGuard is the only thing that can call push/pop
   friend class PerfGuard;
 };
@@ -0,0 +1,99 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef PERFTRACEBUFFER_H
+#define PERFTRACEBUFFER_H
+
+#include "MooseTypes.h"
+
+// System Includes
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+/**
+ * One timed section as recorded for the timeline trace
+ */
+struct PerfTraceEvent
+{
+  /// The section that was timed
+  PerfID _id;
+
+  /// When the section started
+  std::chrono::time_point<std::chrono::steady_clock> _start;
+
+  /// How long it took
+  std::chrono::steady_clock::duration _duration;
+};
+
+/**
+ * Fixed size ring buffer of PerfTraceEvents written by exactly one thread.
+ *
+ * Recording does not take any locks: the owning thread writes the slot and then publishes it by
+ * advancing the head.  When the buffer is full the oldest events are overwritten.  Reading is only
+ * meaningful while the owning thread is not recording (i.e. outside of threaded loops).
+ */
+class PerfTraceBuffer
+{
+public:
+  PerfTraceBuffer(const std::size_t capacity) : _events(capacity), _head(0) {}
+
+  /**
+   * Record an event, only to be called by the thread owning this buffer
+   */
+  void record(const PerfID id,
+              const std::chrono::time_point<std::chrono::steady_clock> start,
+              const std::chrono::time_point<std::chrono::steady_clock> end)
+  {
+    const auto head = _head.load(std::memory_order_relaxed);
+
+    auto & event = _events[head % _events.size()];
+    event._id = id;
+    event._start = start;
+    event._duration = end - start;
+
+    _head.store(head + 1, std::memory_order_release);
+  }
+
+  /**
+   * The number of events that were overwritten before they could be read
+   */
+  std::size_t numDropped() const
+  {
+    const auto head = _head.load(std::memory_order_acquire);
+    return head > _events.size() ? head - _events.size() : 0;
+  }
+
+  /**
+   * Call action(event) for the events held in the buffer, oldest first
+   */
+  template <typename Action>
+  void forEach(Action && action) const
+  {
+    const auto head = _head.load(std::memory_order_acquire);
+    const auto begin = head > _events.size() ? head - _events.size() : 0;
+
+    for (auto i = begin; i < head; i++)
+      action(_events[i % _events.size()]);
+  }
+
+  /**
+   * Forget all recorded events
+   */
+  void clear() { _head.store(0, std::memory_order_release); }
+
+protected:
+  /// The storage for the events
+  std::vector<PerfTraceEvent> _events;
+
+  /// The total number of events recorded, the next one goes to _head % capacity
+  std::atomic<std::size_t> _head;
+};
+
+#endif
@@ -0,0 +1,66 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef PERFTRACEGUARD_H
+#define PERFTRACEGUARD_H
+
+#include "MooseTypes.h"
+#include "PerfGraph.h"
+
+/**
+ * Scope guard for recording a section executed by any thread into the timeline trace.
+ *
+ * Unlike PerfGuard this does not add anything to the graph (which may only be touched by the
+ * master thread), it only records an event into the trace buffer of the given thread.  When
+ * tracing is not enabled the only cost is checking a flag.
+ */
+class PerfTraceGuard
+{
+public:
+  /**
+   * Start recording for the given ID
+   *
+   * @param graph The graph holding the trace buffers
+   * @param id The unique id of the section
+   * @param tid The thread executing the section
+   */
+  PerfTraceGuard(PerfGraph & graph, const PerfID id, const THREAD_ID tid)
+    : _graph(graph), _id(id), _tid(tid), _active(graph.tracing())
+  {
+    if (_active)
+      _start = std::chrono::steady_clock::now();
+  }
+
+  /**
+   * Stop recording
+   */
+  ~PerfTraceGuard()
+  {
+    if (_active)
+      _graph.recordTraceEvent(_tid, _id, _start, std::chrono::steady_clock::now());
+  }
+
+protected:
+  /// The graph we're working on
+  PerfGraph & _graph;
+
+  /// The section being recorded
+  const PerfID _id;
+
+  /// The thread executing the section
+  const THREAD_ID _tid;
+
+  /// Whether or not tracing was enabled when the section started
+  const bool _active;
+
+  /// When the section started
+  std::chrono::time_point<std::chrono::steady_clock> _start;
+};
+
+#endif
@@ -0,0 +1,233 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef SYMMETRICRANKFOURTENSOR_H
+#define SYMMETRICRANKFOURTENSOR_H
+
+#include "Moose.h"
+#include "DataIO.h"
+#include "RankFourTensor.h"
+#include "SymmetricRankTwoTensor.h"
+
+// Forward declarations
+class MooseEnum;
+class SymmetricRankFourTensor;
+
+template <typename T>
+void mooseSetToZero(T & v);
+
+/**
+ * Helper function template specialization to set an object to zero.
+ * Needed by DerivativeMaterialInterface
+ */
+template <>
+void mooseSetToZero<SymmetricRankFourTensor>(SymmetricRankFourTensor & v);
+
+/**
+ * SymmetricRankFourTensor stores a fourth order tensor with the minor symmetries
+ * C_ijkl = C_jikl = C_ijlk (e.g. an elasticity tensor) as a 6x6 matrix in Mandel notation,
+ *
+ *   M_ab = w_a w_b C_ijkl  with  w = 1 for the normal and sqrt(2) for the shear components,
+ *
+ * using the component ordering of SymmetricRankTwoTensor. In this form the contraction
+ * C_ijkl a_kl, the composition C_ijmn D_mnkl, the inverse on the space of symmetric tensors and
+ * rotations are plain 6x6 matrix operations on 36 instead of 81 entries. Major symmetry is not
+ * assumed.
+ */
+class SymmetricRankFourTensor
+{
+public:
+  /// Initialization method
+  enum InitMethod
+  {
+    initNone,
+    initIdentitySymmetricFour
+  };
+
+  /// Default constructor; fills to zero
+  SymmetricRankFourTensor();
+
+  /// Select specific initialization pattern
+  SymmetricRankFourTensor(const InitMethod);
+
+  /// Fill from vector using one of the RankFourTensor fill methods
+  SymmetricRankFourTensor(const std::vector<Real> & input, RankFourTensor::FillMethod fill_method);
+
+  /// Construct from the minor symmetric part of a full tensor
+  explicit SymmetricRankFourTensor(const RankFourTensor & a);
+
+  /// Named constructor for 0.5 * (delta_ik delta_jl + delta_il delta_jk)
+  static SymmetricRankFourTensor IdentitySymmetricFour()
+  {
+    return SymmetricRankFourTensor(initIdentitySymmetricFour);
+  }
+
+  /// Convert to a full RankFourTensor
+  RankFourTensor toRankFourTensor() const;
+
+  /// Gets the tensor component C_ijkl for i, j, k, l = 0, 1, 2
+  Real operator()(unsigned int i, unsigned int j, unsigned int k, unsigned int l) const;
+
+  /// Gets the Mandel matrix entry M_ab.  Takes a, b = 0..5
+  inline Real & operator()(unsigned int a, unsigned int b) { return _vals[a * N + b]; }
+
+  /// Gets the Mandel matrix entry M_ab.  Takes a, b = 0..5
+  inline Real operator()(unsigned int a, unsigned int b) const { return _vals[a * N + b]; }
+
+  /// Zeros out the tensor.
+  void zero();
+
+  /// Print the Mandel matrix
+  void print(std::ostream & stm = Moose::out) const;
+
+  /// C_ijkl*a_kl
+  SymmetricRankTwoTensor operator*(const SymmetricRankTwoTensor & a) const;
+
+  /// C_ijkl*a_kl for the symmetric part of a
+  RankTwoTensor operator*(const RankTwoTensor & a) const;
+
+  /// C_ijpq*a_pqkl
+  SymmetricRankFourTensor operator*(const SymmetricRankFourTensor & a) const;
+
+  /// C_ijkl*a
+  SymmetricRankFourTensor operator*(const Real a) const;
+
+  /// C_ijkl *= a
+  SymmetricRankFourTensor & operator*=(const Real a);
+
+  /// C_ijkl/a
+  SymmetricRankFourTensor operator/(const Real a) const;
+
+  /// C_ijkl /= a
+  SymmetricRankFourTensor & operator/=(const Real a);
+
+  /// C_ijkl + a_ijkl
+  SymmetricRankFourTensor operator+(const SymmetricRankFourTensor & a) const;
+
+  /// C_ijkl += a_ijkl
+  SymmetricRankFourTensor & operator+=(const SymmetricRankFourTensor & a);
+
+  /// C_ijkl - a_ijkl
+  SymmetricRankFourTensor operator-(const SymmetricRankFourTensor & a) const;
+
+  /// C_ijkl -= a_ijkl
+  SymmetricRankFourTensor & operator-=(const SymmetricRankFourTensor & a);
+
+  /// -C_ijkl
+  SymmetricRankFourTensor operator-() const;
+
+  /// sqrt(C_ijkl*C_ijkl)
+  Real L2norm() const;
+
+  /// Sum of C_iijj for i and j ranging from 0 to 2, used in the volumetric locking correction
+  Real sum3x3() const;
+
+  /// Sum of C_iijj over j for each i, used in the volumetric locking correction
+  RealGradient sum3x1() const;
+
+  /**
+   * This returns A_ijkl such that C_ijkl*A_klmn = 0.5*(de_im de_jn + de_in de_jm),
+   * which is the inverse of the Mandel matrix
+   */
+  SymmetricRankFourTensor invSymm() const;
+
+  /**
+   * Rotate the tensor using
+   * C_ijkl = R_im R_jn R_ko R_lp C_mnop
+   */
+  template <class T>
+  void rotate(const T & R);
+
+  /**
+   * Transpose the tensor by swapping the first pair with the second pair of indices
+   * @return C_klij
+   */
+  SymmetricRankFourTensor transposeMajor() const;
+
+  /// checks if the tensor is symmetric, i.e. C_ijkl = C_klij
+  bool isSymmetric() const;
+
+  /// checks if the tensor is isotropic
+  bool isIsotropic() const;
+
+  /// Number of rows and columns of the Mandel matrix
+  static constexpr unsigned int N = SymmetricRankTwoTensor::N;
+
+  /// Number of entries of the Mandel matrix
+  static constexpr unsigned int N2 = N * N;
+
+protected:
+  /// The Mandel matrix in row major order
+  Real _vals[N2];
+
+  template <class T>
+  friend void dataStore(std::ostream &, T &, void *);
+
+  template <class T>
+  friend void dataLoad(std::istream &, T &, void *);
+};
+
+template <>
+void dataStore(std::ostream &, SymmetricRankFourTensor &, void *);
+
+template <>
+void dataLoad(std::istream &, SymmetricRankFourTensor &, void *);
+
+inline SymmetricRankFourTensor operator*(Real a, const SymmetricRankFourTensor & b)
+{
+  return b * a;
+}
+
+template <class T>
+void
+SymmetricRankFourTensor::rotate(const T & R)
+{
+  // Rotating a symmetric tensor is a linear map on its Mandel vector, a' = Q a. The columns of
+  // Q are the rotated Mandel basis tensors, so that C' = Q C Q^T.
+  Real Q[N][N];
+  for (unsigned int b = 0; b < N; ++b)
+  {
+    const unsigned int k = SymmetricRankTwoTensor::full_index[b][0];
+    const unsigned int l = SymmetricRankTwoTensor::full_index[b][1];
+    for (unsigned int a = 0; a < N; ++a)
+    {
+      const unsigned int i = SymmetricRankTwoTensor::full_index[a][0];
+      const unsigned int j = SymmetricRankTwoTensor::full_index[a][1];
+      const Real Rik_Rjl = R(i, k) * R(j, l);
+      if (k == l)
+        Q[a][b] = SymmetricRankTwoTensor::mandel_factor[a] * Rik_Rjl;
+      else
+        Q[a][b] = SymmetricRankTwoTensor::mandel_factor[a] * M_SQRT1_2 *
+                  (Rik_Rjl + R(i, l) * R(j, k));
+    }
+  }
+
+  // QC = Q C
+  Real QC[N][N];
+  for (unsigned int a = 0; a < N; ++a)
+    for (unsigned int b = 0; b < N; ++b)
+    {
+      Real sum = 0.0;
+      for (unsigned int c = 0; c < N; ++c)
+        sum += Q[a][c] * _vals[c * N + b];
+      QC[a][b] = sum;
+    }
+
+  // C' = QC Q^T
+  for (unsigned int a = 0; a < N; ++a)
+    for (unsigned int b = 0; b < N; ++b)
+    {
+      Real sum = 0.0;
+      for (unsigned int c = 0; c < N; ++c)
+        sum += QC[a][c] * Q[b][c];
+      _vals[a * N + b] = sum;
+    }
+}
+
+#endif // SYMMETRICRANKFOURTENSOR_H
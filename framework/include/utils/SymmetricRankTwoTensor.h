@@ -0,0 +1,203 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef SYMMETRICRANKTWOTENSOR_H
+#define SYMMETRICRANKTWOTENSOR_H
+
+#include "Moose.h"
+#include "DataIO.h"
+
+#include "libmesh/libmesh.h"
+
+// Forward declarations
+class RankTwoTensor;
+class SymmetricRankTwoTensor;
+class SymmetricRankFourTensor;
+
+template <typename T>
+void mooseSetToZero(T & v);
+
+/**
+ * Helper function template specialization to set an object to zero.
+ * Needed by DerivativeMaterialInterface
+ */
+template <>
+void mooseSetToZero<SymmetricRankTwoTensor>(SymmetricRankTwoTensor & v);
+
+/**
+ * SymmetricRankTwoTensor stores a symmetric second order tensor (e.g. a stress or small strain)
+ * as the 6 components of its Mandel vector
+ *
+ *   [ a_11, a_22, a_33, sqrt(2) a_23, sqrt(2) a_13, sqrt(2) a_12 ]
+ *
+ * The Mandel basis is orthonormal, so the double contraction of two tensors is the plain dot
+ * product of their vectors and a SymmetricRankFourTensor acts on them as an ordinary 6x6 matrix.
+ * The entries are accessed with i, j = 0, 1, 2 through operator(), or with the Mandel index
+ * 0..5 through operator[].
+ */
+class SymmetricRankTwoTensor
+{
+public:
+  /// Initialization method
+  enum InitMethod
+  {
+    initNone,
+    initIdentity
+  };
+
+  /// Default constructor; fills to zero
+  SymmetricRankTwoTensor();
+
+  /// Select specific initialization pattern
+  SymmetricRankTwoTensor(const InitMethod);
+
+  /// Construct from the six tensor components a_11, a_22, a_33, a_23, a_13, a_12
+  SymmetricRankTwoTensor(Real S11, Real S22, Real S33, Real S23, Real S13, Real S12);
+
+  /// Construct from the symmetric part of a full tensor
+  explicit SymmetricRankTwoTensor(const RankTwoTensor & a);
+
+  /// Named constructor for the identity tensor
+  static SymmetricRankTwoTensor Identity() { return SymmetricRankTwoTensor(initIdentity); }
+
+  /// Convert to a full (symmetric) RankTwoTensor
+  RankTwoTensor toRankTwoTensor() const;
+
+  /// Gets the tensor component a_ij for i, j = 0, 1, 2
+  Real operator()(unsigned int i, unsigned int j) const;
+
+  /// Gets the Mandel component for the index specified.  Takes index = 0..5
+  inline Real & operator[](unsigned int a) { return _vals[a]; }
+
+  /// Gets the Mandel component for the index specified.  Takes index = 0..5
+  inline Real operator[](unsigned int a) const { return _vals[a]; }
+
+  /// Zeros out the tensor.
+  void zero();
+
+  /// Print the tensor
+  void print(std::ostream & stm = Moose::out) const;
+
+  /// a_ij + b_ij
+  SymmetricRankTwoTensor operator+(const SymmetricRankTwoTensor & b) const;
+
+  /// a_ij += b_ij
+  SymmetricRankTwoTensor & operator+=(const SymmetricRankTwoTensor & b);
+
+  /// a_ij - b_ij
+  SymmetricRankTwoTensor operator-(const SymmetricRankTwoTensor & b) const;
+
+  /// a_ij -= b_ij
+  SymmetricRankTwoTensor & operator-=(const SymmetricRankTwoTensor & b);
+
+  /// -a_ij
+  SymmetricRankTwoTensor operator-() const;
+
+  /// a_ij * b
+  SymmetricRankTwoTensor operator*(const Real b) const;
+
+  /// a_ij *= b
+  SymmetricRankTwoTensor & operator*=(const Real b);
+
+  /// a_ij / b
+  SymmetricRankTwoTensor operator/(const Real b) const;
+
+  /// a_ij /= b
+  SymmetricRankTwoTensor & operator/=(const Real b);
+
+  /// a_ij * b_ij
+  Real doubleContraction(const SymmetricRankTwoTensor & b) const;
+
+  /// a_ii
+  Real trace() const;
+
+  /// sqrt(a_ij * a_ij)
+  Real L2norm() const;
+
+  /// a_ij - a_kk / 3 delta_ij
+  SymmetricRankTwoTensor deviatoric() const;
+
+  /// R_ik a_kl R_jl
+  template <class T>
+  SymmetricRankTwoTensor rotated(const T & R) const;
+
+  /// R_ik a_kl R_jl
+  template <class T>
+  void rotate(const T & R);
+
+  /// Number of Mandel components
+  static constexpr unsigned int N = 6;
+
+  /// Tensor indices i and j of each Mandel component
+  static constexpr unsigned int full_index[N][2] = {
+      {0, 0}, {1, 1}, {2, 2}, {1, 2}, {0, 2}, {0, 1}};
+
+  /// Mandel component holding a_ij and a_ji
+  static constexpr unsigned int mandel_index[3][3] = {{0, 5, 4}, {5, 1, 3}, {4, 3, 2}};
+
+  /// Scaling of each Mandel component with respect to the tensor component
+  static constexpr Real mandel_factor[N] = {1.0, 1.0, 1.0, M_SQRT2, M_SQRT2, M_SQRT2};
+
+protected:
+  /// The Mandel vector
+  Real _vals[N];
+
+  template <class T>
+  friend void dataStore(std::ostream &, T &, void *);
+
+  template <class T>
+  friend void dataLoad(std::istream &, T &, void *);
+
+  friend class SymmetricRankFourTensor;
+};
+
+template <>
+void dataStore(std::ostream &, SymmetricRankTwoTensor &, void *);
+
+template <>
+void dataLoad(std::istream &, SymmetricRankTwoTensor &, void *);
+
+inline SymmetricRankTwoTensor operator*(Real a, const SymmetricRankTwoTensor & b) { return b * a; }
+
+template <class T>
+SymmetricRankTwoTensor
+SymmetricRankTwoTensor::rotated(const T & R) const
+{
+  // full tensor components of this tensor
+  Real a[3][3];
+  for (unsigned int i = 0; i < 3; ++i)
+    for (unsigned int j = 0; j < 3; ++j)
+      a[i][j] = (*this)(i, j);
+
+  // only the six independent components of R a R^T are formed
+  SymmetricRankTwoTensor result(initNone);
+  for (unsigned int m = 0; m < N; ++m)
+  {
+    const unsigned int i = full_index[m][0];
+    const unsigned int j = full_index[m][1];
+    Real sum = 0.0;
+    for (unsigned int k = 0; k < 3; ++k)
+    {
+      const Real Rik = R(i, k);
+      for (unsigned int l = 0; l < 3; ++l)
+        sum += Rik * a[k][l] * R(j, l);
+    }
+    result._vals[m] = mandel_factor[m] * sum;
+  }
+  return result;
+}
+
+template <class T>
+void
+SymmetricRankTwoTensor::rotate(const T & R)
+{
+  *this = rotated(R);
+}
+
+#endif // SYMMETRICRANKTWOTENSOR_H
@@ -20,6 +20,11 @@ public:
   std::string getInfo() const;
   std::string getTimeStamp(time_t * time_stamp = NULL) const;
 
+  /**
+   * The modification time of the executable, or an empty string if it cannot be found
+   */
+  std::string getExecutableTimeStamp() const;
+
   int argc() const { return _argc; };
   char ** argv() const { return _argv; };
 
@@ -28,8 +28,12 @@ public:
   virtual ~FluidPropertiesMaterialPT();
 
 protected:
+  virtual void computeProperties() override;
   virtual void computeQpProperties();
 
+  /// Whether the properties of all quadrature points are computed in one call
+  const bool _vectorize;
+
   /// Pressure (Pa)
   const VariableValue & _pressure;
   /// Temperature (K)
@@ -262,6 +262,11 @@ public:
   virtual void
   h_from_p_T(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const override;
 
+  virtual void properties_from_p_T(std::size_t n,
+                                   const Real * pressure,
+                                   const Real * temperature,
+                                   const PropertiesPT & props) const override;
+
 protected:
   /// Molar mass of CO2 (kg/mol)
   const Real _Mco2 = 44.0098e-3;
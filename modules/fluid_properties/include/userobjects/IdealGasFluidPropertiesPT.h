@@ -85,6 +85,11 @@ public:
   virtual void
   h_from_p_T(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const override;
 
+  virtual void properties_from_p_T(std::size_t n,
+                                   const Real * pressure,
+                                   const Real * temperature,
+                                   const PropertiesPT & props) const override;
+
   virtual Real henryConstant(Real temperature) const override;
 
   virtual void henryConstant_dT(Real temperature, Real & Kh, Real & dKh_dT) const override;
@@ -113,6 +113,12 @@ public:
   virtual void
   h_from_p_T(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const override;
 
+  /// Fluid properties at a batch of (pressure, temperature) points
+  virtual void properties_from_p_T(std::size_t n,
+                                   const Real * pressure,
+                                   const Real * temperature,
+                                   const PropertiesPT & props) const override;
+
   /// Henry's law constant for dissolution in water
   virtual Real henryConstant(Real temperature) const override;
 
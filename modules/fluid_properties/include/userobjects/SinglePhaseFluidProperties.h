@@ -559,6 +559,59 @@ public:
    */
   virtual Real k_from_rho_T(Real density, Real temperature) const;
 
+  /**
+   * The outputs of properties_from_p_T(), each pointing to an array with an entry for every
+   * (pressure, temperature) point.  Properties whose pointer is null are not computed.  The
+   * derivatives of a property wrt pressure and temperature are computed when the pointer to its
+   * derivative wrt pressure is set, in which case the one to its derivative wrt temperature has
+   * to be set as well.
+   */
+  struct PropertiesPT
+  {
+    /// Density (kg/m^3)
+    Real * rho = nullptr;
+    Real * drho_dp = nullptr;
+    Real * drho_dT = nullptr;
+    /// Internal energy (J/kg)
+    Real * e = nullptr;
+    Real * de_dp = nullptr;
+    Real * de_dT = nullptr;
+    /// Specific enthalpy (J/kg)
+    Real * h = nullptr;
+    Real * dh_dp = nullptr;
+    Real * dh_dT = nullptr;
+    /// Viscosity (Pa.s)
+    Real * mu = nullptr;
+    Real * dmu_dp = nullptr;
+    Real * dmu_dT = nullptr;
+    /// Specific entropy (J/kg/K)
+    Real * s = nullptr;
+    /// Isobaric specific heat capacity (J/kg/K)
+    Real * cp = nullptr;
+    /// Isochoric specific heat capacity (J/kg/K)
+    Real * cv = nullptr;
+    /// Speed of sound (m/s)
+    Real * c = nullptr;
+    /// Thermal conductivity (W/m/K)
+    Real * k = nullptr;
+  };
+
+  /**
+   * A set of properties and their derivatives at a number of (pressure, temperature) points,
+   * e.g. the quadrature points of an element, in a single call.  Fluids override this to share
+   * the work that the properties of a point have in common, such as finding the density or the
+   * region of a multi-region formulation, instead of repeating it in every property.  The
+   * default computes the properties one at a time.
+   * @param n number of points
+   * @param pressure fluid pressures (Pa)
+   * @param temperature fluid temperatures (K)
+   * @param[out] props the properties to compute
+   */
+  virtual void properties_from_p_T(std::size_t n,
+                                   const Real * pressure,
+                                   const Real * temperature,
+                                   const PropertiesPT & props) const;
+
   /**
    * Henry's law constant for dissolution in water
    * @param temperature fluid temperature (K)
@@ -11,6 +11,7 @@
 #define WATER97FLUIDPROPERTIES_H
 
 #include "SinglePhaseFluidPropertiesPT.h"
+#include "MathUtils.h"
 #include <array>
 
 class Water97FluidProperties;
@@ -122,6 +123,11 @@ public:
   virtual void
   h_from_p_T(Real pressure, Real temperature, Real & h, Real & dh_dp, Real & dh_dT) const override;
 
+  virtual void properties_from_p_T(std::size_t n,
+                                   const Real * pressure,
+                                   const Real * temperature,
+                                   const PropertiesPT & props) const override;
+
   virtual Real vaporPressure(Real temperature) const override;
 
   virtual void vaporPressure_dT(Real temperature, Real & psat, Real & dpsat_dT) const override;
@@ -481,6 +487,90 @@ protected:
    */
   Real d2gamma5_dpitau(Real pi, Real tau) const;
 
+  /**
+   * The dimensionless Gibbs (regions 1, 2 and 5) or Helmholtz (region 3) free energy and its
+   * first and second derivatives wrt its reduced arguments, which are (pi, tau) for the Gibbs
+   * and (delta, tau) for the Helmholtz free energy
+   */
+  struct FreeEnergy
+  {
+    Real f;
+    Real df_dx;
+    Real d2f_dx2;
+    Real df_dtau;
+    Real d2f_dtau2;
+    Real d2f_dxtau;
+  };
+
+  /**
+   * Gibbs free energy in Region 1 and all its derivatives in a single pass over the
+   * coefficients, so that the powers of pi and tau are computed once for all of them
+   *
+   * @param pi reduced pressure (-)
+   * @param tau reduced temperature (-)
+   * @param[out] gamma Gibbs free energy and its derivatives wrt pi and tau (-)
+   */
+  void gamma1Derivatives(Real pi, Real tau, FreeEnergy & gamma) const;
+
+  /**
+   * Gibbs free energy in Region 2 and all its derivatives in a single pass
+   *
+   * @param pi reduced pressure (-)
+   * @param tau reduced temperature (-)
+   * @param[out] gamma Gibbs free energy and its derivatives wrt pi and tau (-)
+   */
+  void gamma2Derivatives(Real pi, Real tau, FreeEnergy & gamma) const;
+
+  /**
+   * Helmholtz free energy in Region 3 and all its derivatives in a single pass
+   *
+   * @param delta reduced density (-)
+   * @param tau reduced temperature (-)
+   * @param[out] phi Helmholtz free energy and its derivatives wrt delta and tau (-)
+   */
+  void phi3Derivatives(Real delta, Real tau, FreeEnergy & phi) const;
+
+  /**
+   * Gibbs free energy in Region 5 and all its derivatives in a single pass
+   *
+   * @param pi reduced pressure (-)
+   * @param tau reduced temperature (-)
+   * @param[out] gamma Gibbs free energy and its derivatives wrt pi and tau (-)
+   */
+  void gamma5Derivatives(Real pi, Real tau, FreeEnergy & gamma) const;
+
+  /**
+   * Adds the series sum_i n_i x^I_i y^J_i, starting at index first, and its derivatives wrt x
+   * and y to a free energy.  Only the powers of the second derivatives are computed, the
+   * others follow from them by multiplication.
+   */
+  template <std::size_t N>
+  void addPowerSeries(const std::array<Real, N> & n,
+                      const std::array<int, N> & I,
+                      const std::array<int, N> & J,
+                      std::size_t first,
+                      Real x,
+                      Real y,
+                      FreeEnergy & fe) const
+  {
+    for (std::size_t i = first; i < N; ++i)
+    {
+      const Real x2 = MathUtils::pow(x, I[i] - 2);
+      const Real x1 = x2 * x;
+      const Real x0 = x1 * x;
+      const Real y2 = MathUtils::pow(y, J[i] - 2);
+      const Real y1 = y2 * y;
+      const Real y0 = y1 * y;
+
+      fe.f += n[i] * x0 * y0;
+      fe.df_dx += n[i] * I[i] * x1 * y0;
+      fe.d2f_dx2 += n[i] * I[i] * (I[i] - 1) * x2 * y0;
+      fe.df_dtau += n[i] * J[i] * x0 * y1;
+      fe.d2f_dtau2 += n[i] * J[i] * (J[i] - 1) * x0 * y2;
+      fe.d2f_dxtau += n[i] * I[i] * J[i] * x1 * y1;
+    }
+  }
+
   /// Enum of subregion ids for region 3
   enum subregionEnum
   {
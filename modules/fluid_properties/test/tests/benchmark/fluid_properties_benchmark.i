@@ -0,0 +1,115 @@
+# Timing of FluidPropertiesMaterialPT computing all quadrature points of an element in one call
+# to the fluid properties (default) against one quadrature point at a time
+# (Materials/fp_mat/vectorize=false) for several fluids (Materials/fp_mat/fp)
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./dummy]
+  [../]
+[]
+
+[AuxVariables]
+  [./pressure]
+  [../]
+  [./temperature]
+  [../]
+  [./rho]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+  [./h]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[Functions]
+  [./pic]
+    type = ParsedFunction
+    value = '1e6 + 19e6 * x'
+  [../]
+  [./tic]
+    type = ParsedFunction
+    value = '310 + 190 * y'
+  [../]
+[]
+
+[ICs]
+  [./p_ic]
+    type = FunctionIC
+    function = pic
+    variable = pressure
+  [../]
+  [./t_ic]
+    type = FunctionIC
+    function = tic
+    variable = temperature
+  [../]
+[]
+
+[AuxKernels]
+  [./rho]
+    type = MaterialRealAux
+    variable = rho
+    property = density
+    execute_on = timestep_end
+  [../]
+  [./h]
+    type = MaterialRealAux
+    variable = h
+    property = h
+    execute_on = timestep_end
+  [../]
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./water]
+      type = Water97FluidProperties
+    [../]
+    [./co2]
+      type = CO2FluidProperties
+    [../]
+    [./idealgas]
+      type = IdealGasFluidPropertiesPT
+    [../]
+    [./simple]
+      type = SimpleFluidProperties
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./fp_mat]
+    type = FluidPropertiesMaterialPT
+    pressure = pressure
+    temperature = temperature
+    fp = water
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = dummy
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  solve_type = NEWTON
+  [./Quadrature]
+    order = FOURTH
+  [../]
+[]
+
+[Outputs]
+  perf_graph = true
+[]
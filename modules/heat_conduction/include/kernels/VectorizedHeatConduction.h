@@ -0,0 +1,46 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef VECTORIZEDHEATCONDUCTION_H
+#define VECTORIZEDHEATCONDUCTION_H
+
+#include "VectorizedKernel.h"
+#include "MaterialProperty.h"
+
+// Forward Declarations
+class VectorizedHeatConduction;
+
+template <>
+InputParameters validParams<VectorizedHeatConduction>();
+
+/**
+ * HeatConduction with all quadrature points of an element computed at once, see VectorizedKernel
+ */
+class VectorizedHeatConduction : public VectorizedKernel
+{
+public:
+  VectorizedHeatConduction(const InputParameters & parameters);
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+
+  virtual void computeResidualBatch(DenseVector<Number> & re) override;
+  virtual void computeJacobianBatch(DenseMatrix<Number> & ke) override;
+
+private:
+  const MaterialProperty<Real> & _diffusion_coefficient;
+  const MaterialProperty<Real> * const _diffusion_coefficient_dT;
+
+  /// Weights and weighted test function values for the batch methods
+  std::vector<Real> _weights;
+  std::vector<Real> _weighted_test;
+};
+
+#endif // VECTORIZEDHEATCONDUCTION_H
@@ -0,0 +1,55 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 3
+  ny = 3
+[]
+
+[Variables]
+  [./temp]
+    order = SECOND
+    initial_condition = 300
+  [../]
+[]
+
+[Kernels]
+  [./heat]
+    type = VectorizedHeatConduction
+    variable = temp
+  [../]
+  [./source]
+    type = HeatSource
+    variable = temp
+    value = 1e3
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = temp
+    boundary = left
+    value = 300
+  [../]
+[]
+
+[Functions]
+  [./k]
+    type = PiecewiseLinear
+    x = '0 1000'
+    y = '1 3'
+  [../]
+[]
+
+[Materials]
+  [./conductivity]
+    type = HeatConductionMaterial
+    temp = temp
+    thermal_conductivity_temperature_function = k
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
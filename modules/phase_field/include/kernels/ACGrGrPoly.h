@@ -22,17 +22,42 @@ InputParameters validParams<ACGrGrPoly>();
  * This kernel calculates the residual for grain growth for a single phase,
  * poly-crystal system. A single material property gamma_asymm is used for
  * the prefactor of the cross-terms between order parameters.
+ *
+ * The sum over the other order parameters is computed once per quadrature point and element.
+ * The Jacobian block of another order parameter is proportional to its value and is skipped on
+ * elements where that order parameter is inactive.  The blocks are still allocated for all
+ * order parameters, only their assembly is skipped.
  */
 class ACGrGrPoly : public ACGrGrBase
 {
 public:
   ACGrGrPoly(const InputParameters & parameters);
 
+  /// The parameters that the actions setting up this kernel pass on to it
+  static InputParameters actionParameters();
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(MooseVariableFEBase & jvar) override;
+  using ACGrGrBase::computeOffDiagJacobian;
+
 protected:
   virtual Real computeDFDOP(PFFunctionType type);
   virtual Real computeQpOffDiagJacobian(unsigned int jvar);
 
+  /// Compute the sum of the squares of the other order parameters at the quadrature points
+  void computeSumEtaj();
+
   const MaterialProperty<Real> & _gamma;
+
+  /// Order parameters whose magnitude does not exceed this on an element are inactive there
+  const Real _inactive_op_threshold;
+
+  /// Sum of the squares of the other order parameters at each quadrature point
+  std::vector<Real> _sum_etaj;
+
+  /// Index into _vals of each coupled variable number, invalid_uint for other variables
+  std::vector<unsigned int> _op_index;
 };
 
 #endif // ACGRGRPOLY_H
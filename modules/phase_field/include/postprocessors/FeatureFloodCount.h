@@ -454,8 +454,13 @@ protected:
                    unsigned int var_num = invalid_id);
 
   /**
-   * This routine is called on the master rank only and stitches together the partial
-   * feature pieces seen on any processor.
+   * This routine stitches together the partial feature pieces seen on any processor. It is called
+   * on the processors merging the data of their children in the reduction tree (see
+   * communicateAndMerge()), the master rank performs the last merge.
+   *
+   * Only pairs of features whose bounding boxes intersect or that share periodic nodes are checked
+   * (see findMergeCandidates()), the mergeable pairs are joined in a union-find structure and each
+   * resulting set is merged into a single feature.
    */
   virtual void mergeSets();
 
@@ -463,9 +468,21 @@ protected:
    * Method for determining whether two features are mergeable. This routine exists because
    * derived classes may need to override this function rather than use the mergeable method
    * in the FeatureData object.
+   *
+   * Note: mergeSets() only calls this for the pairs returned by findMergeCandidates(). Derived
+   * classes that merge features which neither touch nor share periodic nodes must also override
+   * mergeSets().
    */
   virtual bool areFeaturesMergeable(const FeatureData & f1, const FeatureData & f2) const;
 
+  /**
+   * Find the pairs (i < j) of features with the same variable index whose bounding boxes
+   * intersect (with a sort and sweep over the boxes along x) or that share periodic nodes. These
+   * are the only pairs that can be mergeable.
+   */
+  void findMergeCandidates(const std::vector<FeatureData *> & features,
+                           std::vector<std::pair<std::size_t, std::size_t>> & candidates) const;
+
   /**
    * This routine handles all of the serialization, communication and deserialization of the data
    * structures containing FeatureData objects.
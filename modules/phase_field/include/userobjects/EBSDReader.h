@@ -13,7 +13,11 @@
 #include "EulerAngleProvider.h"
 #include "EBSDAccessFunctors.h"
 
+// C++ includes
+#include <array>
+
 class EBSDReader;
+class EBSDBinaryFile;
 
 template <>
 InputParameters validParams<EBSDReader>();
@@ -33,6 +37,10 @@ InputParameters validParams<EBSDReader>();
  * Phases are referred to using the numbers in the EBSD data file. In case the phase number in the
  * data file
  * starts at 1 the phase 0 will simply contain no grains.
+ *
+ * A text EBSD file is read completely on every processor. A binary EBSD file (see EBSDBinaryFile)
+ * is memory-mapped and every processor only loads the data points that its semilocal elements
+ * overlap, the grain averages are read from the file.
  */
 class EBSDReader : public EulerAngleProvider, public EBSDAccessFunctors
 {
@@ -141,6 +149,14 @@ protected:
   /// Logically three-dimensional data indexed by geometric points in a 1D vector
   std::vector<EBSDPointData> _data;
 
+  /// The memory-mapped binary EBSD file, nullptr for text files
+  std::unique_ptr<EBSDBinaryFile> _binary_file;
+
+  ///@{ First grid index and number of points in x, y and z direction of the part of the grid in _data
+  std::array<unsigned int, 3> _data_min_index;
+  std::array<unsigned int, 3> _data_n;
+  ///@}
+
   /// Averages by (global) grain ID
   std::vector<EBSDAvgData> _avg_data;
 
@@ -177,7 +193,7 @@ protected:
   /// Maximum grid extent
   Real _maxx, _maxy, _maxz;
 
-  /// Computes a global index in the _data array given an input *centroid* point
+  /// Computes an index in the _data array given an input *centroid* point
   unsigned indexFromPoint(const Point & p) const;
 
   /// Transfer the index into the _avg_data array from given index
@@ -185,6 +201,18 @@ protected:
 
   /// Build grain and phase weight maps
   void buildNodeWeightMaps();
+
+  /// Read the text EBSD file of a dim dimensional grid and average the data over the grains
+  void readTextFile(const std::string & filename, unsigned int dim);
+
+  /// Read the grain averages from the binary EBSD file
+  void readBinaryAvgData();
+
+  /// Load the part of the binary EBSD data that the semilocal elements overlap into _data
+  void loadLocalData();
+
+  /// Link the averaged Euler angles into the averages and number the grains of each phase
+  void indexGrains();
 };
 
 #endif // EBSDREADER_H
@@ -12,6 +12,7 @@
 
 #include <array>
 #include "PolycrystalUserObjectBase.h"
+#include "PeriodicKDTree.h"
 #include "DelimitedFileReader.h"
 
 // Forward Declarations
@@ -53,6 +54,12 @@ protected:
 
   std::vector<Point> _centerpoints; // x,y,z coordinates of circle centers
   std::vector<Real> _radii;         // Radius for each circular grain created
+
+  /// Search tree over the circle centers, projected to the x-y plane for columnar_3D
+  PeriodicKDTree _center_tree;
+
+  /// Largest of the _radii
+  Real _max_radius;
 };
 
 #endif // POLYCRYSTALCIRCLES_H
@@ -11,6 +11,7 @@
 #define POLYCRYSTALVORONOI_H
 
 #include "PolycrystalUserObjectBase.h"
+#include "PeriodicKDTree.h"
 
 // Forward Declarations
 class PolycrystalVoronoi;
@@ -44,6 +45,9 @@ protected:
 
   std::vector<Point> _centerpoints;
 
+  /// Search tree over the _centerpoints, built at the end of precomputeGrainStructure()
+  PeriodicKDTree _center_tree;
+
   const FileName _file_name;
 };
 
@@ -0,0 +1,78 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef DISJOINTSETS_H
+#define DISJOINTSETS_H
+
+#include <numeric>
+#include <utility>
+#include <vector>
+
+/**
+ * Union-find (disjoint-set forest) over the indices [0, size) with union by rank and path
+ * halving. Any sequence of find() and join() calls is effectively linear in the number of calls.
+ */
+class DisjointSets
+{
+public:
+  DisjointSets(std::size_t size) : _parent(size), _rank(size, 0)
+  {
+    std::iota(_parent.begin(), _parent.end(), 0);
+  }
+
+  /**
+   * The representative of the set containing i
+   */
+  std::size_t find(std::size_t i)
+  {
+    while (_parent[i] != i)
+    {
+      _parent[i] = _parent[_parent[i]];
+      i = _parent[i];
+    }
+    return i;
+  }
+
+  /**
+   * Join the sets containing i and j
+   *
+   * @return false when i and j were already in the same set
+   */
+  bool join(std::size_t i, std::size_t j)
+  {
+    i = find(i);
+    j = find(j);
+
+    if (i == j)
+      return false;
+
+    if (_rank[i] < _rank[j])
+      std::swap(i, j);
+
+    _parent[j] = i;
+    if (_rank[i] == _rank[j])
+      ++_rank[i];
+
+    return true;
+  }
+
+  /**
+   * The number of elements
+   */
+  std::size_t size() const { return _parent.size(); }
+
+protected:
+  /// The parent of each element (the element itself for the representatives)
+  std::vector<std::size_t> _parent;
+
+  /// Upper bound of the height of the tree below each representative
+  std::vector<unsigned int> _rank;
+};
+
+#endif // DISJOINTSETS_H
@@ -0,0 +1,145 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef EBSDBINARYFILE_H
+#define EBSDBINARYFILE_H
+
+#include "EBSDAccessFunctors.h"
+#include "EBSDMesh.h"
+
+// C++ includes
+#include <cstdint>
+#include <map>
+
+/**
+ * A memory-mapped binary EBSD data file.
+ *
+ * The file holds the grid of the EBSD text file header, the data points in the [z][y][x] order
+ * of the EBSDReader with the Euler angles in degrees, and the per grain averages in global grain
+ * ID order, so that reading it needs neither parsing nor a pass over all points.  The points and
+ * averages are fixed size records of doubles and 32 bit integers in the byte order of the
+ * machine that wrote the file.
+ *
+ * The file is mapped read-only and shared, so the processes on a node share the pages of the
+ * file in the page cache, and only the pages of the points a process reads are loaded.
+ */
+class EBSDBinaryFile
+{
+public:
+  /// Open and map a binary EBSD file, errors if the file is not one
+  EBSDBinaryFile(const std::string & filename);
+  ~EBSDBinaryFile();
+
+  /// Whether a file starts like a binary EBSD file
+  static bool isBinary(const std::string & filename);
+
+  /**
+   * Write a binary EBSD file.
+   * @param filename The name of the file
+   * @param geometry The grid of the data
+   * @param custom_columns The number of custom data columns
+   * @param data The data points in [z][y][x] order
+   * @param avg_data The averages by (global) grain ID
+   * @param avg_angles The averaged Euler angles by (global) grain ID
+   * @param global_id_map The map from EBSD feature ID to (global) grain ID
+   */
+  static void write(const std::string & filename,
+                    const EBSDMesh::EBSDMeshGeometry & geometry,
+                    unsigned int custom_columns,
+                    const std::vector<EBSDAccessFunctors::EBSDPointData> & data,
+                    const std::vector<EBSDAccessFunctors::EBSDAvgData> & avg_data,
+                    const std::vector<EulerAngles> & avg_angles,
+                    const std::map<unsigned int, unsigned int> & global_id_map);
+
+  /// The grid of the data
+  const EBSDMesh::EBSDMeshGeometry & geometry() const { return _geometry; }
+
+  unsigned int customColumns() const { return _header.custom_columns; }
+  std::size_t numPoints() const { return _header.n_points; }
+  std::size_t numGrains() const { return _header.n_grains; }
+
+  /// Copy the data point with the given index of the [z][y][x] order
+  void readPoint(std::size_t index, EBSDAccessFunctors::EBSDPointData & d) const;
+
+  /**
+   * Copy the averages of a (global) grain.
+   * @param global_id The grain
+   * @param a The averages, the averaged Euler angles are not linked into it
+   * @param angles The averaged Euler angles
+   * @param feature_id The EBSD feature ID of the grain
+   */
+  void readAvgData(std::size_t global_id,
+                   EBSDAccessFunctors::EBSDAvgData & a,
+                   EulerAngles & angles,
+                   unsigned int & feature_id) const;
+
+protected:
+  /// The header at the start of the file
+  struct Header
+  {
+    char magic[16];
+    std::uint32_t dim;
+    std::uint32_t n[3];
+    std::uint32_t custom_columns;
+    std::uint32_t unused;
+    double d[3];
+    double min[3];
+    std::uint64_t n_points;
+    std::uint64_t n_grains;
+  };
+
+  /// The fixed part of a data point, followed by the custom columns
+  struct PointRecord
+  {
+    double angles[3];
+    double p[3];
+    std::uint32_t feature_id;
+    std::uint32_t phase;
+    std::uint32_t symmetry;
+    std::uint32_t unused;
+  };
+
+  /// The fixed part of the averages of a grain, followed by the custom columns
+  struct AvgRecord
+  {
+    double angles[3];
+    double p[3];
+    std::uint32_t feature_id;
+    std::uint32_t phase;
+    std::uint32_t symmetry;
+    std::uint32_t n;
+  };
+
+  static std::size_t pointRecordSize(unsigned int custom_columns)
+  {
+    return sizeof(PointRecord) + custom_columns * sizeof(double);
+  }
+  static std::size_t avgRecordSize(unsigned int custom_columns)
+  {
+    return sizeof(AvgRecord) + custom_columns * sizeof(double);
+  }
+
+  const std::string _filename;
+
+  /// File descriptor of the mapped file
+  int _fd;
+
+  /// The mapped file
+  const char * _map;
+  std::size_t _size;
+
+  Header _header;
+  EBSDMesh::EBSDMeshGeometry _geometry;
+
+  /// Start of the data points and averages in the mapped file
+  const char * _points;
+  const char * _grains;
+};
+
+#endif // EBSDBINARYFILE_H
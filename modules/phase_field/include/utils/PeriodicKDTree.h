@@ -0,0 +1,73 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef PERIODICKDTREE_H
+#define PERIODICKDTREE_H
+
+#include "KDTree.h"
+
+// Forward Declarations
+class MooseMesh;
+
+/**
+ * A KDTree over a set of points (e.g. grain centers) whose searches use the distance of
+ * MooseMesh::minPeriodicDistance() for a variable.  The tree holds the points only once, a
+ * search is repeated for the periodic images of the query point that are closer to the periodic
+ * boundaries than the search radius.
+ */
+class PeriodicKDTree
+{
+public:
+  /**
+   * @param mesh The mesh whose extent defines the periodic widths
+   * @param nonlinear_var_num The variable whose periodic boundary conditions are applied
+   */
+  PeriodicKDTree(const MooseMesh & mesh, unsigned int nonlinear_var_num);
+
+  /// Build the tree over a copy of points, after the periodic boundary conditions were set up
+  void build(const std::vector<Point> & points);
+
+  /**
+   * The point with the smallest MooseMesh::minPeriodicDistance() to p, the one with the lowest
+   * index of several points at the same distance.
+   */
+  std::size_t nearest(const Point & p) const;
+
+  /**
+   * Find the points that may be less than radius away from p in periodic distance.  The result
+   * contains every such point but may contain a few more, so callers filter it with their own
+   * distance.
+   * @param p The query point
+   * @param radius The search radius
+   * @param indices The sorted indices of the points found, cleared first
+   */
+  void radiusSearch(const Point & p, Real radius, std::vector<std::size_t> & indices) const;
+
+protected:
+  const MooseMesh & _mesh;
+
+  const unsigned int _nonlinear_var_num;
+
+  /// The points the tree was built over, the tree refers to them
+  std::vector<Point> _points;
+
+  std::unique_ptr<KDTree> _kd_tree;
+
+  /// Width of the mesh in each periodic direction, 0 in the other directions
+  Point _periodic_width;
+
+  /// The bounding box of the mesh
+  Point _min_corner;
+  Point _max_corner;
+
+  /// Slack added to search radii so that points at the same distance are never missed
+  Real _tolerance;
+};
+
+#endif // PERIODICKDTREE_H
@@ -0,0 +1,86 @@
+# Assembly benchmark for the GrainGrowth action: a Voronoi polycrystal with a fixed number of
+# grains is solved with more and more order parameters.  With the full SMP every element assembles
+# op_num x op_num Jacobian blocks, of which only those of the few locally nonzero order parameters
+# are computed with a positive inactive_op_threshold.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 60
+  ny = 60
+  xmax = 1000
+  ymax = 1000
+  elem_type = QUAD4
+[]
+
+[GlobalParams]
+  op_num = 8
+  var_name_base = gr
+[]
+
+[Modules]
+  [./PhaseField]
+    [./GrainGrowth]
+    [../]
+  [../]
+[]
+
+[UserObjects]
+  [./voronoi]
+    type = PolycrystalVoronoi
+    grain_num = 40
+    rand_seed = 8675
+  [../]
+[]
+
+[ICs]
+  [./PolycrystalICs]
+    [./PolycrystalColoringIC]
+      polycrystal_ic_uo = voronoi
+    [../]
+  [../]
+[]
+
+[BCs]
+  [./Periodic]
+    [./all]
+      auto_direction = 'x y'
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./Copper]
+    type = GBEvolution
+    T = 500 # K
+    wGB = 30 # nm
+    GBmob0 = 2.5e-6 #m^4/(Js) from Schoenfelder 1997
+    Q = 0.23 #Migration energy in eV
+    GBenergy = 0.708 #GB energy in J/m^2
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  scheme = bdf2
+
+  solve_type = 'NEWTON'
+  petsc_options_iname = '-pc_type'
+  petsc_options_value = 'asm'
+  l_tol = 1.0e-4
+  l_max_its = 30
+  nl_max_its = 20
+  nl_rel_tol = 1.0e-9
+  num_steps = 3
+  dt = 20.0
+[]
+
+[Outputs]
+  perf_graph = true
+[]
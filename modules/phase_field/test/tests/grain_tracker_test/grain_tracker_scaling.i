@@ -0,0 +1,62 @@
+# Scaling benchmark for the feature merging in the GrainTracker: a large Voronoi polycrystal is
+# flooded and merged once (no solve). Run on increasing numbers of processors with more grains.
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 200
+  ny = 200
+  xmax = 1000
+  ymax = 1000
+  elem_type = QUAD4
+[]
+
+[GlobalParams]
+  op_num = 25
+  var_name_base = gr
+[]
+
+[Variables]
+  [./PolycrystalVariables]
+  [../]
+[]
+
+[UserObjects]
+  [./voronoi]
+    type = PolycrystalVoronoi
+    grain_num = 500
+    rand_seed = 8675
+  [../]
+  [./grain_tracker]
+    type = GrainTracker
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[ICs]
+  [./PolycrystalICs]
+    [./PolycrystalColoringIC]
+      polycrystal_ic_uo = voronoi
+    [../]
+  [../]
+[]
+
+[BCs]
+  [./Periodic]
+    [./all]
+      auto_direction = 'x y'
+    [../]
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 3
+[]
+
+[Outputs]
+  perf_graph = true
+[]
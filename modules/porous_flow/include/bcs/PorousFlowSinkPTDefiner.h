@@ -11,6 +11,7 @@
 #define POROUSFLOWSINKPTDEFINER_H
 
 #include "PorousFlowSink.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowSinkPTDefiner;
 
@@ -32,7 +33,7 @@ protected:
   const MaterialProperty<std::vector<Real>> * const _pp;
 
   /// d(Nodal pore pressure in each phase)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _dpp_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> * const _dpp_dvar;
 
   /// Nodal temperature
   const MaterialProperty<Real> * const _temp;
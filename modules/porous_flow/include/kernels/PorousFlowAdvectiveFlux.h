@@ -11,6 +11,7 @@
 #define POROUSFLOWADVECTIVEFLUX_H
 
 #include "PorousFlowDarcyBase.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowAdvectiveFlux;
 
@@ -35,13 +36,13 @@ protected:
   const MaterialProperty<std::vector<std::vector<Real>>> & _mass_fractions;
 
   /// Derivative of the mass fraction of each component in each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_fractions_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 3>> & _dmass_fractions_dvar;
 
   /// Relative permeability of each phase
   const MaterialProperty<std::vector<Real>> & _relative_permeability;
 
   /// Derivative of relative permeability of each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _drelative_permeability_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _drelative_permeability_dvar;
 
   /// Index of the fluid component that this kernel acts on
   const unsigned int _fluid_component;
@@ -12,6 +12,7 @@
 
 #include "Kernel.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowDarcyBase;
 
@@ -97,19 +98,19 @@ protected:
   const MaterialProperty<std::vector<Real>> & _fluid_density_node;
 
   /// Derivative of the fluid density for each phase wrt PorousFlow variables (at the node)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_node_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dfluid_density_node_dvar;
 
   /// Fluid density for each phase (at the qp)
   const MaterialProperty<std::vector<Real>> & _fluid_density_qp;
 
   /// Derivative of the fluid density for each phase wrt PorousFlow variables (at the qp)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_qp_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dfluid_density_qp_dvar;
 
   /// Viscosity of each component in each phase
   const MaterialProperty<std::vector<Real>> & _fluid_viscosity;
 
   /// Derivative of the fluid viscosity for each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_viscosity_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dfluid_viscosity_dvar;
 
   /// Nodal pore pressure in each phase
   const MaterialProperty<std::vector<Real>> & _pp;
@@ -118,10 +119,10 @@ protected:
   const MaterialProperty<std::vector<RealGradient>> & _grad_p;
 
   /// Derivative of Grad porepressure in each phase wrt grad(PorousFlow variables)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dgrad_p_dgrad_var;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dgrad_p_dgrad_var;
 
   /// Derivative of Grad porepressure in each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<RealGradient>>> & _dgrad_p_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<RealGradient, 2>> & _dgrad_p_dvar;
 
   /// PorousFlowDictator UserObject
   const PorousFlowDictator & _dictator;
@@ -13,6 +13,7 @@
 #include "Kernel.h"
 #include "PorousFlowDictator.h"
 #include "RankTwoTensor.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowDispersiveFlux;
 
@@ -48,13 +49,13 @@ protected:
   const MaterialProperty<std::vector<Real>> & _fluid_density_qp;
 
   /// Derivative of the fluid density for each phase wrt PorousFlow variables (at the qp)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_qp_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dfluid_density_qp_dvar;
 
   /// Gradient of mass fraction of each component in each phase
   const MaterialProperty<std::vector<std::vector<RealGradient>>> & _grad_mass_frac;
 
   /// Derivative of mass fraction wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_frac_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 3>> & _dmass_frac_dvar;
 
   /// Porosity at the qps
   const MaterialProperty<Real> & _porosity_qp;
@@ -90,13 +91,13 @@ protected:
   const MaterialProperty<std::vector<Real>> & _relative_permeability;
 
   /// Derivative of relative permeability wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _drelative_permeability_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _drelative_permeability_dvar;
 
   /// Viscosity of each component in each phase
   const MaterialProperty<std::vector<Real>> & _fluid_viscosity;
 
   /// Derivative of viscosity wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_viscosity_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dfluid_viscosity_dvar;
 
   /// Permeability of porous material
   const MaterialProperty<RealTensorValue> & _permeability;
@@ -111,10 +112,10 @@ protected:
   const MaterialProperty<std::vector<RealGradient>> & _grad_p;
 
   /// Derivative of Grad porepressure in each phase wrt grad(PorousFlow variables)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dgrad_p_dgrad_var;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dgrad_p_dgrad_var;
 
   /// Derivative of Grad porepressure in each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<RealGradient>>> & _dgrad_p_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<RealGradient, 2>> & _dgrad_p_dvar;
 
   /// Gravitational acceleration
   const RealVectorValue _gravity;
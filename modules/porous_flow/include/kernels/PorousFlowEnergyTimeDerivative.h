@@ -12,6 +12,7 @@
 
 #include "TimeDerivative.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowEnergyTimeDerivative;
 
@@ -78,7 +79,7 @@ protected:
   const MaterialProperty<std::vector<Real>> * const _fluid_density_old;
 
   /// d(nodal fluid density)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _dfluid_density_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> * const _dfluid_density_dvar;
 
   /// Nodal fluid saturation
   const MaterialProperty<std::vector<Real>> * const _fluid_saturation_nodal;
@@ -87,7 +88,7 @@ protected:
   const MaterialProperty<std::vector<Real>> * const _fluid_saturation_nodal_old;
 
   /// d(nodal fluid saturation)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _dfluid_saturation_nodal_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> * const _dfluid_saturation_nodal_dvar;
 
   /// Internal energy of the phases, evaluated at the nodes
   const MaterialProperty<std::vector<Real>> * const _energy_nodal;
@@ -96,7 +97,7 @@ protected:
   const MaterialProperty<std::vector<Real>> * const _energy_nodal_old;
 
   /// d(internal energy)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _denergy_nodal_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> * const _denergy_nodal_dvar;
 
   /**
    * Derivative of residual with respect to PorousFlow variable number pvar
@@ -12,6 +12,7 @@
 
 #include "Kernel.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowFullySaturatedDarcyBase;
 
@@ -60,13 +61,13 @@ protected:
   const MaterialProperty<std::vector<Real>> & _density;
 
   /// Derivative of the fluid density for each phase wrt PorousFlow variables (at the qp)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _ddensity_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _ddensity_dvar;
 
   /// Viscosity of the fluid at the qp
   const MaterialProperty<std::vector<Real>> & _viscosity;
 
   /// Derivative of the fluid viscosity  wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dviscosity_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dviscosity_dvar;
 
   /// Quadpoint pore pressure in each phase
   const MaterialProperty<std::vector<Real>> & _pp;
@@ -75,10 +76,10 @@ protected:
   const MaterialProperty<std::vector<RealGradient>> & _grad_p;
 
   /// Derivative of Grad porepressure in each phase wrt grad(PorousFlow variables)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dgrad_p_dgrad_var;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dgrad_p_dgrad_var;
 
   /// Derivative of Grad porepressure in each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<RealGradient>>> & _dgrad_p_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<RealGradient, 2>> & _dgrad_p_dvar;
 
   /// PorousFlowDictator UserObject
   const PorousFlowDictator & _dictator;
@@ -11,6 +11,7 @@
 #define POROUSFLOWFULLYSATURATEDDARCYFLOW_H
 
 #include "PorousFlowFullySaturatedDarcyBase.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowFullySaturatedDarcyFlow;
 
@@ -43,7 +44,7 @@ protected:
   const MaterialProperty<std::vector<std::vector<Real>>> & _mfrac;
 
   /// Derivative of mass fraction wrt wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmfrac_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 3>> & _dmfrac_dvar;
 
   /// The fluid component for this Kernel
   const unsigned int _fluid_component;
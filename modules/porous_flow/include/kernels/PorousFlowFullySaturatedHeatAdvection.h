@@ -11,6 +11,7 @@
 #define POROUSFLOWFULLYSATURATEDHEATADVECTION_H
 
 #include "PorousFlowFullySaturatedDarcyBase.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowFullySaturatedHeatAdvection;
 
@@ -34,7 +35,7 @@ protected:
   const MaterialProperty<std::vector<Real>> & _enthalpy;
 
   /// Derivative of the enthalpy wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _denthalpy_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _denthalpy_dvar;
 };
 
 #endif // POROUSFLOWFULLYSATURATEDHEATADVECTION_H
@@ -12,6 +12,7 @@
 
 #include "TimeDerivative.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowHeatVolumetricExpansion;
 
@@ -69,19 +70,19 @@ protected:
   const MaterialProperty<std::vector<Real>> * const _fluid_density;
 
   /// d(nodal fluid density)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _dfluid_density_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> * const _dfluid_density_dvar;
 
   /// Nodal fluid saturation
   const MaterialProperty<std::vector<Real>> * const _fluid_saturation_nodal;
 
   /// d(nodal fluid saturation)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _dfluid_saturation_nodal_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> * const _dfluid_saturation_nodal_dvar;
 
   /// Internal energy of the phases, evaluated at the nodes
   const MaterialProperty<std::vector<Real>> * const _energy_nodal;
 
   /// d(internal energy)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _denergy_nodal_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> * const _denergy_nodal_dvar;
 
   /// Strain rate
   const MaterialProperty<Real> & _strain_rate_qp;
@@ -12,6 +12,7 @@
 
 #include "TimeDerivative.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowMassRadioactiveDecay;
 
@@ -68,19 +69,19 @@ protected:
   const MaterialProperty<std::vector<Real>> & _fluid_density;
 
   /// d(nodal fluid density)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dfluid_density_dvar;
 
   /// Nodal fluid saturation
   const MaterialProperty<std::vector<Real>> & _fluid_saturation_nodal;
 
   /// d(nodal fluid saturation)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_saturation_nodal_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dfluid_saturation_nodal_dvar;
 
   /// Nodal mass fraction
   const MaterialProperty<std::vector<std::vector<Real>>> & _mass_frac;
 
   /// d(nodal mass fraction)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_frac_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 3>> & _dmass_frac_dvar;
 
   /**
    * Derivative of residual with respect to PorousFlow variable number pvar
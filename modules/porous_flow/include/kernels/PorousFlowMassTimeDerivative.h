@@ -12,6 +12,7 @@
 
 #include "TimeDerivative.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowMassTimeDerivative;
 
@@ -71,7 +72,7 @@ protected:
   const MaterialProperty<std::vector<Real>> & _fluid_density_old;
 
   /// d(nodal fluid density)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dfluid_density_dvar;
 
   /// Nodal fluid saturation
   const MaterialProperty<std::vector<Real>> & _fluid_saturation_nodal;
@@ -80,7 +81,7 @@ protected:
   const MaterialProperty<std::vector<Real>> & _fluid_saturation_nodal_old;
 
   /// d(nodal fluid saturation)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_saturation_nodal_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dfluid_saturation_nodal_dvar;
 
   /// Nodal mass fraction
   const MaterialProperty<std::vector<std::vector<Real>>> & _mass_frac;
@@ -89,7 +90,7 @@ protected:
   const MaterialProperty<std::vector<std::vector<Real>>> & _mass_frac_old;
 
   /// d(nodal mass fraction)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_frac_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 3>> & _dmass_frac_dvar;
 
   /**
    * Derivative of residual with respect to PorousFlow variable number pvar
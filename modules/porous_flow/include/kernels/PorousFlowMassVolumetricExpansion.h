@@ -13,6 +13,7 @@
 #include "TimeDerivative.h"
 #include "PorousFlowDictator.h"
 #include "RankTwoTensor.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowMassVolumetricExpansion;
 
@@ -69,19 +70,19 @@ protected:
   const MaterialProperty<std::vector<Real>> & _fluid_density;
 
   /// d(fluid density)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dfluid_density_dvar;
 
   /// Fluid saturation
   const MaterialProperty<std::vector<Real>> & _fluid_saturation;
 
   /// d(fluid saturation)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_saturation_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dfluid_saturation_dvar;
 
   /// Mass fraction
   const MaterialProperty<std::vector<std::vector<Real>>> & _mass_frac;
 
   /// d(mass fraction)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_frac_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 3>> & _dmass_frac_dvar;
 
   /// Strain rate
   const MaterialProperty<Real> & _strain_rate_qp;
@@ -12,6 +12,7 @@
 
 #include "TimeDerivative.h"
 #include "PorousFlowDictator.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowPreDis;
 
@@ -49,7 +50,7 @@ protected:
   const MaterialProperty<std::vector<Real>> & _saturation;
 
   /// d(saturation)/d(PorousFlow var)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dsaturation_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dsaturation_dvar;
 
   /// Reaction rate of the yielding the secondary species
   const MaterialProperty<std::vector<Real>> & _reaction_rate;
@@ -11,6 +11,7 @@
 #define POROUSFLOWDARCYVELOCITYMATERIAL_H
 
 #include "PorousFlowMaterial.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowDarcyVelocityMaterial;
 
@@ -47,28 +48,28 @@ protected:
   const MaterialProperty<std::vector<Real>> & _fluid_density;
 
   /// Derivative of the fluid density for each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dfluid_density_dvar;
 
   /// Viscosity of each component in each phase
   const MaterialProperty<std::vector<Real>> & _fluid_viscosity;
 
   /// Derivative of the fluid viscosity for each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_viscosity_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dfluid_viscosity_dvar;
 
   /// Relative permeability of each phase
   const MaterialProperty<std::vector<Real>> & _relative_permeability;
 
   /// Derivative of relative permeability of each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<Real>>> & _drelative_permeability_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _drelative_permeability_dvar;
 
   /// Gradient of the pore pressure in each phase
   const MaterialProperty<std::vector<RealGradient>> & _grad_p;
 
   /// Derivative of Grad porepressure in each phase wrt grad(PorousFlow variables)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dgrad_p_dgradvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dgrad_p_dgradvar;
 
   /// Derivative of Grad porepressure in each phase wrt PorousFlow variables
-  const MaterialProperty<std::vector<std::vector<RealGradient>>> & _dgrad_p_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<RealGradient, 2>> & _dgrad_p_dvar;
 
   /// Gravity
   const RealVectorValue _gravity;
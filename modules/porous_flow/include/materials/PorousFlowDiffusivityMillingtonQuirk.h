@@ -11,6 +11,7 @@
 #define POROUSFLOWDIFFUSIVITYMILLINGTONQUIRK_H
 
 #include "PorousFlowDiffusivityBase.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowDiffusivityMillingtonQuirk;
 
@@ -38,7 +39,7 @@ protected:
   /// Saturation of each phase at the qps
   const MaterialProperty<std::vector<Real>> & _saturation_qp;
   /// Derivative of saturation of each phase wrt PorousFlow variables (at the qps)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dsaturation_qp_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dsaturation_qp_dvar;
 };
 
 #endif // POROUSFLOWDIFFUSIVITYMILLINGTONQUIRK_H
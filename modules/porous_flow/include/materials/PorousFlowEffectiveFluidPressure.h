@@ -11,6 +11,7 @@
 #define POROUSFLOWEFFECTIVEFLUIDPRESSURE_H
 
 #include "PorousFlowMaterialVectorBase.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowEffectiveFluidPressure;
 
@@ -39,7 +40,7 @@ protected:
   const MaterialProperty<std::vector<Real>> & _porepressure_old;
 
   /// d(porepressure)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dporepressure_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dporepressure_dvar;
 
   /// Quadpoint or nodal saturation of each phase
   const MaterialProperty<std::vector<Real>> & _saturation;
@@ -48,7 +49,7 @@ protected:
   const MaterialProperty<std::vector<Real>> & _saturation_old;
 
   /// d(saturation)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dsaturation_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dsaturation_dvar;
 
   /// Computed effective fluid pressure (at quadpoints or nodes)
   MaterialProperty<Real> & _pf;
@@ -12,6 +12,7 @@
 
 #include "PorousFlowVariableBase.h"
 #include "PorousFlowFluidStateBase.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowFluidStateFlashBase;
 class PorousFlowCapillaryPressure;
@@ -105,22 +106,22 @@ protected:
   /// Gradient of the mass fraction matrix (only defined at the qps)
   MaterialProperty<std::vector<std::vector<RealGradient>>> * _grad_mass_frac_qp;
   /// Derivative of the mass fraction matrix with respect to the Porous Flow variables
-  MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_frac_dvar;
+  MaterialProperty<PorousFlowDerivativeTensor<Real, 3>> & _dmass_frac_dvar;
   /// Old value of saturation
   const MaterialProperty<std::vector<Real>> & _saturation_old;
 
   /// Fluid density of each phase
   MaterialProperty<std::vector<Real>> & _fluid_density;
   /// Derivative of the fluid density for each phase wrt PorousFlow variables
-  MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_density_dvar;
+  MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dfluid_density_dvar;
   /// Viscosity of each phase
   MaterialProperty<std::vector<Real>> & _fluid_viscosity;
   /// Derivative of the fluid viscosity for each phase wrt PorousFlow variables
-  MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_viscosity_dvar;
+  MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dfluid_viscosity_dvar;
   /// Enthalpy of each phase
   MaterialProperty<std::vector<Real>> & _fluid_enthalpy;
   /// Derivative of the fluid enthalpy for each phase wrt PorousFlow variables
-  MaterialProperty<std::vector<std::vector<Real>>> & _dfluid_enthalpy_dvar;
+  MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dfluid_enthalpy_dvar;
 
   /// Conversion from degrees Celsius to degrees Kelvin
   const Real _T_c2k;
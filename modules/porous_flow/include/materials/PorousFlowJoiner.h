@@ -11,6 +11,7 @@
 #define POROUSFLOWJOINER_H
 
 #include "PorousFlowMaterialVectorBase.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowJoiner;
 
@@ -47,10 +48,10 @@ protected:
   const std::string _pf_prop;
 
   /// Derivatives of porepressure variable wrt PorousFlow variables at the qps or nodes
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dporepressure_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dporepressure_dvar;
 
   /// Derivatives of saturation variable wrt PorousFlow variables at the qps or nodes
-  const MaterialProperty<std::vector<std::vector<Real>>> & _dsaturation_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dsaturation_dvar;
 
   /// Derivatives of temperature variable wrt PorousFlow variables at the qps or nodes
   const MaterialProperty<std::vector<Real>> & _dtemperature_dvar;
@@ -59,7 +60,7 @@ protected:
   MaterialProperty<std::vector<Real>> & _property;
 
   /// d(property)/d(PorousFlow variable)
-  MaterialProperty<std::vector<std::vector<Real>>> & _dproperty_dvar;
+  MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dproperty_dvar;
 
   /// Property of each phase
   std::vector<const MaterialProperty<Real> *> _phase_property;
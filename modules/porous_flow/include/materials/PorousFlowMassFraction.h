@@ -11,6 +11,7 @@
 #define POROUSFLOWMASSFRACTION_H
 
 #include "PorousFlowMaterialVectorBase.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowMassFraction;
 
@@ -34,7 +35,7 @@ protected:
   MaterialProperty<std::vector<std::vector<RealGradient>>> * const _grad_mass_frac;
 
   /// Derivative of the mass fraction matrix with respect to the porous flow variables
-  MaterialProperty<std::vector<std::vector<std::vector<Real>>>> & _dmass_frac_dvar;
+  MaterialProperty<PorousFlowDerivativeTensor<Real, 3>> & _dmass_frac_dvar;
 
   virtual void initQpStatefulProperties() override;
   virtual void computeQpProperties() override;
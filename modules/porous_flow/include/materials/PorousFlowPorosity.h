@@ -11,6 +11,7 @@
 #define POROUSFLOWPOROSITY_H
 
 #include "PorousFlowPorosityExponentialBase.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowPorosity;
 
@@ -122,7 +123,7 @@ protected:
   const MaterialProperty<std::vector<Real>> * const _saturation;
 
   /// d(saturation)/d(PorousFlow var)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _dsaturation_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> * const _dsaturation_dvar;
 };
 
 #endif // POROUSFLOWPOROSITY_H
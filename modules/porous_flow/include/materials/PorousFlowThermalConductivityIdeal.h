@@ -11,6 +11,7 @@
 #define POROUSFLOWTHERMALCONDUCTIVITYIDEAL_H
 
 #include "PorousFlowThermalConductivityBase.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowThermalConductivityIdeal;
 
@@ -54,7 +55,7 @@ protected:
   const MaterialProperty<std::vector<Real>> * const _saturation_qp;
 
   /// d(Saturation)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> * const _dsaturation_qp_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> * const _dsaturation_qp_dvar;
 };
 
 #endif // POROUSFLOWTHERMALCONDUCTIVITYIDEAL_H
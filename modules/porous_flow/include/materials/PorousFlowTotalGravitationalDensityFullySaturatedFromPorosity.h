@@ -11,6 +11,7 @@
 #define POROUSFLOWTOTALGRAVITATIONALDENSITYFULLYSATURATEDFROMPOROSITY_H
 
 #include "PorousFlowTotalGravitationalDensityBase.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowTotalGravitationalDensityFullySaturatedFromPorosity;
 
@@ -45,7 +46,7 @@ protected:
   const MaterialProperty<Real> & _porosity_qp;
 
   /// d(rho_f)/d(PorousFlow variable)
-  const MaterialProperty<std::vector<std::vector<Real>>> & _drho_f_qp_dvar;
+  const MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _drho_f_qp_dvar;
 
   /// d(porosity)/d(PorousFlow variable)
   const MaterialProperty<std::vector<Real>> & _dporosity_qp_dvar;
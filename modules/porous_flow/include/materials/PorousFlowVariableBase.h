@@ -12,6 +12,7 @@
 
 #include "DerivativeMaterialInterface.h"
 #include "PorousFlowMaterial.h"
+#include "PorousFlowDerivativeTensor.h"
 
 class PorousFlowVariableBase;
 
@@ -45,31 +46,31 @@ protected:
   MaterialProperty<std::vector<Real>> & _porepressure;
 
   /// d(porepressure)/d(PorousFlow variable)
-  MaterialProperty<std::vector<std::vector<Real>>> & _dporepressure_dvar;
+  MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dporepressure_dvar;
 
   /// Grad(p) at the quadpoints
   MaterialProperty<std::vector<RealGradient>> * const _gradp_qp;
 
   /// d(grad porepressure)/d(grad PorousFlow variable) at the quadpoints
-  MaterialProperty<std::vector<std::vector<Real>>> * const _dgradp_qp_dgradv;
+  MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> * const _dgradp_qp_dgradv;
 
   /// d(grad porepressure)/d(PorousFlow variable) at the quadpoints
-  MaterialProperty<std::vector<std::vector<RealGradient>>> * const _dgradp_qp_dv;
+  MaterialProperty<PorousFlowDerivativeTensor<RealGradient, 2>> * const _dgradp_qp_dv;
 
   /// Computed nodal or qp saturation of the phases
   MaterialProperty<std::vector<Real>> & _saturation;
 
   /// d(saturation)/d(PorousFlow variable)
-  MaterialProperty<std::vector<std::vector<Real>>> & _dsaturation_dvar;
+  MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> & _dsaturation_dvar;
 
   /// Grad(s) at the quadpoints
   MaterialProperty<std::vector<RealGradient>> * const _grads_qp;
 
   /// d(grad saturation)/d(grad PorousFlow variable) at the quadpoints
-  MaterialProperty<std::vector<std::vector<Real>>> * const _dgrads_qp_dgradv;
+  MaterialProperty<PorousFlowDerivativeTensor<Real, 2>> * const _dgrads_qp_dgradv;
 
   /// d(grad saturation)/d(PorousFlow variable) at the quadpoints
-  MaterialProperty<std::vector<std::vector<RealGradient>>> * const _dgrads_qp_dv;
+  MaterialProperty<PorousFlowDerivativeTensor<RealGradient, 2>> * const _dgrads_qp_dv;
 };
 
 #endif // POROUSFLOWVARIABLEBASE_H
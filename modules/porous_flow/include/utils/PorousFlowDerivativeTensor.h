@@ -0,0 +1,175 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef POROUSFLOWDERIVATIVETENSOR_H
+#define POROUSFLOWDERIVATIVETENSOR_H
+
+#include "DataIO.h"
+#include "MooseError.h"
+
+// C++ includes
+#include <vector>
+
+/**
+ * A view of N dimensions into the entries of a PorousFlowDerivativeTensor.  Indexing it gives
+ * a view of one dimension less, down to the entries themselves.
+ */
+template <typename T, unsigned int N>
+class PorousFlowDerivativeTensorSlice
+{
+public:
+  PorousFlowDerivativeTensorSlice(T * data, const std::size_t * extent)
+    : _data(data), _extent(extent)
+  {
+  }
+
+  /// Number of entries in the first dimension of the view
+  std::size_t size() const { return _extent[0]; }
+
+  PorousFlowDerivativeTensorSlice<T, N - 1> operator[](std::size_t i) const
+  {
+    mooseAssert(i < _extent[0], "PorousFlowDerivativeTensor index out of range");
+    std::size_t stride = 1;
+    for (unsigned int d = 1; d < N; ++d)
+      stride *= _extent[d];
+    return PorousFlowDerivativeTensorSlice<T, N - 1>(_data + i * stride, _extent + 1);
+  }
+
+private:
+  T * _data;
+  const std::size_t * _extent;
+};
+
+/// A view of one dimension, i.e. a row of entries
+template <typename T>
+class PorousFlowDerivativeTensorSlice<T, 1>
+{
+public:
+  PorousFlowDerivativeTensorSlice(T * data, const std::size_t * extent)
+    : _data(data), _extent(extent)
+  {
+  }
+
+  std::size_t size() const { return _extent[0]; }
+
+  T & operator[](std::size_t i) const
+  {
+    mooseAssert(i < _extent[0], "PorousFlowDerivativeTensor index out of range");
+    return _data[i];
+  }
+
+  T * begin() const { return _data; }
+  T * end() const { return _data + _extent[0]; }
+
+private:
+  T * _data;
+  const std::size_t * _extent;
+};
+
+/**
+ * A fixed-stride array of N dimensions (e.g. phases x PorousFlow variables, or
+ * phases x components x PorousFlow variables) whose entries are stored contiguously.
+ *
+ * It replaces nested std::vectors as the type of the derivative material properties, so a
+ * property holds one allocation per quadpoint instead of one for every phase (and component),
+ * which also makes copying it in the stateful material property storage a single copy.
+ * Entries are accessed with the indexing of the nested vectors, tensor[ph][var] or
+ * tensor[ph][comp][var], and the views returned by operator[] have a size() like them.
+ */
+template <typename T, unsigned int N>
+class PorousFlowDerivativeTensor
+{
+public:
+  static_assert(N >= 2, "Use a std::vector for one dimensional derivatives");
+
+  PorousFlowDerivativeTensor()
+  {
+    for (unsigned int d = 0; d < N; ++d)
+      _extent[d] = 0;
+  }
+
+  /// Set the size of both dimensions and all entries to value
+  void assign(std::size_t n0, std::size_t n1, const T & value)
+  {
+    static_assert(N == 2, "Set the size of every dimension");
+    const std::size_t extent[N] = {n0, n1};
+    assign(extent, value);
+  }
+
+  /// Set the size of all three dimensions and all entries to value
+  void assign(std::size_t n0, std::size_t n1, std::size_t n2, const T & value)
+  {
+    static_assert(N == 3, "Set the size of every dimension");
+    const std::size_t extent[N] = {n0, n1, n2};
+    assign(extent, value);
+  }
+
+  /// Set the size of every dimension and all entries to value
+  void assign(const std::size_t * extent, const T & value)
+  {
+    std::size_t size = 1;
+    for (unsigned int d = 0; d < N; ++d)
+    {
+      _extent[d] = extent[d];
+      size *= extent[d];
+    }
+    _data.assign(size, value);
+  }
+
+  /// Number of entries in the first dimension
+  std::size_t size() const { return _extent[0]; }
+
+  /// Number of entries in dimension d
+  std::size_t extent(unsigned int d) const { return _extent[d]; }
+
+  PorousFlowDerivativeTensorSlice<T, N - 1> operator[](std::size_t i)
+  {
+    return PorousFlowDerivativeTensorSlice<T, N>(_data.data(), _extent)[i];
+  }
+
+  PorousFlowDerivativeTensorSlice<const T, N - 1> operator[](std::size_t i) const
+  {
+    return PorousFlowDerivativeTensorSlice<const T, N>(_data.data(), _extent)[i];
+  }
+
+  /// All entries, the last dimension varying fastest
+  std::vector<T> & data() { return _data; }
+  const std::vector<T> & data() const { return _data; }
+
+private:
+  std::size_t _extent[N];
+
+  std::vector<T> _data;
+};
+
+template <typename T, unsigned int N>
+inline void
+dataStore(std::ostream & stream, PorousFlowDerivativeTensor<T, N> & v, void * context)
+{
+  for (unsigned int d = 0; d < N; ++d)
+  {
+    std::size_t extent = v.extent(d);
+    dataStore(stream, extent, context);
+  }
+  dataStore(stream, v.data(), context);
+}
+
+template <typename T, unsigned int N>
+inline void
+dataLoad(std::istream & stream, PorousFlowDerivativeTensor<T, N> & v, void * context)
+{
+  std::size_t extent[N];
+  for (unsigned int d = 0; d < N; ++d)
+    dataLoad(stream, extent[d], context);
+
+  v.assign(extent, T());
+  dataLoad(stream, v.data(), context);
+}
+
+#endif // POROUSFLOWDERIVATIVETENSOR_H
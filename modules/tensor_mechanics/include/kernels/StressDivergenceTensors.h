@@ -13,6 +13,7 @@
 #include "ALEKernel.h"
 #include "RankTwoTensor.h"
 #include "RankFourTensor.h"
+#include "SymmetricRankFourTensor.h"
 
 // Forward Declarations
 class StressDivergenceTensors;
@@ -26,6 +27,9 @@ InputParameters validParams<StressDivergenceTensors>();
  * StressDivergenceTensors mostly copies from StressDivergence.  There are small changes to use
  * RankFourTensor and RankTwoTensors instead of SymmElasticityTensors and SymmTensors.  This is done
  * to allow for more mathematical transparancy.
+ *
+ * The Jacobian multiplier is either the full Jacobian_mult or, if a symmetric stress calculator
+ * provides it, the compact symmetric_Jacobian_mult in Mandel form.
  */
 class StressDivergenceTensors : public ALEKernel
 {
@@ -48,11 +52,21 @@ protected:
   virtual void computeAverageGradientTest();
   virtual void computeAverageGradientPhi();
 
+  ///@{ Small strain Jacobian entries for a full or compact symmetric Jacobian multiplier
+  template <class T>
+  Real computeQpElasticJacobian(const T & jacobian_mult);
+  template <class T>
+  Real computeQpElasticOffDiagJacobian(const T & jacobian_mult, unsigned int coupled_component);
+  ///@}
+
   std::string _base_name;
   bool _use_finite_deform_jacobian;
 
   const MaterialProperty<RankTwoTensor> & _stress;
-  const MaterialProperty<RankFourTensor> & _Jacobian_mult;
+  /// The compact Jacobian multiplier, if the stress calculator provides it
+  const MaterialProperty<SymmetricRankFourTensor> * const _symmetric_Jacobian_mult;
+  /// The full Jacobian multiplier, nullptr if the compact one is used
+  const MaterialProperty<RankFourTensor> * const _Jacobian_mult;
 
   std::vector<RankFourTensor> _finite_deform_Jacobian_mult;
   const MaterialProperty<RankTwoTensor> * _deformation_gradient;
@@ -0,0 +1,49 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef COMPUTESYMMETRICELASTICITYTENSOR_H
+#define COMPUTESYMMETRICELASTICITYTENSOR_H
+
+#include "DerivativeMaterialInterface.h"
+#include "Material.h"
+#include "SymmetricRankFourTensor.h"
+#include "GuaranteeProvider.h"
+
+class ComputeSymmetricElasticityTensor;
+
+template <>
+InputParameters validParams<ComputeSymmetricElasticityTensor>();
+
+/**
+ * ComputeSymmetricElasticityTensor defines an elasticity tensor with minor symmetries, stored as
+ * a 6x6 Mandel matrix in the material property symmetric_elasticity_tensor. It is used together
+ * with the ComputeSymmetric* stress calculators.
+ */
+class ComputeSymmetricElasticityTensor : public DerivativeMaterialInterface<Material>,
+                                         public GuaranteeProvider
+{
+public:
+  ComputeSymmetricElasticityTensor(const InputParameters & parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+
+  std::string _base_name;
+  std::string _elasticity_tensor_name;
+
+  MaterialProperty<SymmetricRankFourTensor> & _elasticity_tensor;
+
+  /// prefactor function to multiply the elasticity tensor with
+  Function * const _prefactor_function;
+
+  /// Individual material information
+  SymmetricRankFourTensor _Cijkl;
+};
+
+#endif // COMPUTESYMMETRICELASTICITYTENSOR_H
@@ -0,0 +1,46 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef COMPUTESYMMETRICFINITESTRAINELASTICSTRESS_H
+#define COMPUTESYMMETRICFINITESTRAINELASTICSTRESS_H
+
+#include "ComputeSymmetricStressBase.h"
+#include "GuaranteeConsumer.h"
+
+class ComputeSymmetricFiniteStrainElasticStress;
+
+template <>
+InputParameters validParams<ComputeSymmetricFiniteStrainElasticStress>();
+
+/**
+ * ComputeSymmetricFiniteStrainElasticStress computes the stress following elasticity
+ * theory for finite strains using a compact symmetric elasticity tensor
+ */
+class ComputeSymmetricFiniteStrainElasticStress : public ComputeSymmetricStressBase,
+                                                  public GuaranteeConsumer
+{
+public:
+  ComputeSymmetricFiniteStrainElasticStress(const InputParameters & parameters);
+
+  void initialSetup() override;
+
+protected:
+  virtual void computeQpStress() override;
+
+  const MaterialProperty<RankTwoTensor> & _strain_increment;
+  const MaterialProperty<RankTwoTensor> & _rotation_increment;
+
+  /**
+   * The old elastic strain is used to calculate the old stress in the case
+   * of variable elasticity tensors
+   */
+  const MaterialProperty<RankTwoTensor> & _elastic_strain_old;
+};
+
+#endif // COMPUTESYMMETRICFINITESTRAINELASTICSTRESS_H
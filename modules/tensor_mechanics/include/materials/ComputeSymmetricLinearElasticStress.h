@@ -0,0 +1,34 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef COMPUTESYMMETRICLINEARELASTICSTRESS_H
+#define COMPUTESYMMETRICLINEARELASTICSTRESS_H
+
+#include "ComputeSymmetricStressBase.h"
+
+class ComputeSymmetricLinearElasticStress;
+
+template <>
+InputParameters validParams<ComputeSymmetricLinearElasticStress>();
+
+/**
+ * ComputeSymmetricLinearElasticStress computes the stress following linear elasticity theory
+ * (small strains) using a compact symmetric elasticity tensor
+ */
+class ComputeSymmetricLinearElasticStress : public ComputeSymmetricStressBase
+{
+public:
+  ComputeSymmetricLinearElasticStress(const InputParameters & parameters);
+  virtual void initialSetup() override;
+
+protected:
+  virtual void computeQpStress() override;
+};
+
+#endif // COMPUTESYMMETRICLINEARELASTICSTRESS_H
@@ -0,0 +1,57 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef COMPUTESYMMETRICSTRESSBASE_H
+#define COMPUTESYMMETRICSTRESSBASE_H
+
+#include "Material.h"
+#include "RankTwoTensor.h"
+#include "RankFourTensor.h"
+#include "SymmetricRankFourTensor.h"
+#include "DerivativeMaterialInterface.h"
+
+class ComputeSymmetricStressBase;
+
+template <>
+InputParameters validParams<ComputeSymmetricStressBase>();
+
+/**
+ * ComputeSymmetricStressBase is the base class for stress calculators that use the compact
+ * symmetric_elasticity_tensor computed by ComputeSymmetricElasticityTensor. The stress and elastic
+ * strain are declared with the same names and types as in ComputeStressBase. The Jacobian
+ * multiplier stays in Mandel form as symmetric_Jacobian_mult, which StressDivergenceTensors uses in
+ * place of Jacobian_mult.
+ */
+class ComputeSymmetricStressBase : public DerivativeMaterialInterface<Material>
+{
+public:
+  ComputeSymmetricStressBase(const InputParameters & parameters);
+
+protected:
+  virtual void initQpStatefulProperties() override;
+  virtual void computeQpProperties() override;
+  virtual void computeQpStress() = 0;
+
+  const std::string _base_name;
+  const std::string _elasticity_tensor_name;
+
+  const MaterialProperty<RankTwoTensor> & _mechanical_strain;
+  MaterialProperty<RankTwoTensor> & _stress;
+  MaterialProperty<RankTwoTensor> & _elastic_strain;
+
+  const MaterialProperty<SymmetricRankFourTensor> & _elasticity_tensor;
+
+  /// Extra stress tensor
+  const MaterialProperty<RankTwoTensor> & _extra_stress;
+
+  /// derivative of stress w.r.t. strain (_dstress_dstrain)
+  MaterialProperty<SymmetricRankFourTensor> & _Jacobian_mult;
+};
+
+#endif // COMPUTESYMMETRICSTRESSBASE_H
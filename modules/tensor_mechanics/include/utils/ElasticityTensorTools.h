@@ -11,6 +11,7 @@
 #define ELASTICITYTENSORTOOLS_H
 
 class RankFourTensor;
+class SymmetricRankFourTensor;
 
 namespace ElasticityTensorTools
 {
@@ -25,6 +26,16 @@ Real elasticJacobian(const RankFourTensor & r4t,
                      const RealGradient & grad_test,
                      const RealGradient & grad_phi);
 
+/**
+ * The same Jacobian entry for an elasticity tensor (or Jacobian multiplier) in the compact Mandel
+ * form, without converting it to a full RankFourTensor
+ */
+Real elasticJacobian(const SymmetricRankFourTensor & r4t,
+                     unsigned int i,
+                     unsigned int k,
+                     const RealGradient & grad_test,
+                     const RealGradient & grad_phi);
+
 /**
  * This is used for the standard kernel stress_ij*d(test)/dx_j, when varied wrt w_k (the cosserat
  * rotation)
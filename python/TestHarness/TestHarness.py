@@ -151,6 +151,7 @@ class TestHarness:
             checks['chaco'] = set(['ALL'])
             checks['party'] = set(['ALL'])
             checks['ptscotch'] = set(['ALL'])
+            checks['petsc_threadsafety'] = set(['ALL'])
             checks['slepc'] = set(['ALL'])
             checks['unique_id'] = set(['ALL'])
             checks['cxx11'] = set(['ALL'])
@@ -177,6 +178,7 @@ class TestHarness:
             checks['chaco'] =  util.getLibMeshConfigOption(self.libmesh_dir, 'chaco')
             checks['party'] =  util.getLibMeshConfigOption(self.libmesh_dir, 'party')
             checks['ptscotch'] =  util.getLibMeshConfigOption(self.libmesh_dir, 'ptscotch')
+            checks['petsc_threadsafety'] =  util.getPetscThreadSafety()
             checks['slepc'] =  util.getLibMeshConfigOption(self.libmesh_dir, 'slepc')
             checks['unique_id'] =  util.getLibMeshConfigOption(self.libmesh_dir, 'unique_id')
             checks['cxx11'] =  util.getLibMeshConfigOption(self.libmesh_dir, 'cxx11')
@@ -410,6 +410,31 @@ def getLibMeshThreadingModel(libmesh_dir):
         threading_models.add("NONE")
     return threading_models
 
+def getPetscThreadSafety():
+    """ Whether PETSc was configured with --with-threadsafety, from the petscconf.h in PETSC_DIR """
+    option_set = set(['ALL'])
+    petsc_dir = os.environ.get('PETSC_DIR', '')
+    petsc_arch = os.environ.get('PETSC_ARCH', '')
+
+    filenames = [
+      os.path.join(petsc_dir, petsc_arch, 'include', 'petscconf.h'),
+      os.path.join(petsc_dir, 'include', 'petscconf.h')
+      ]
+
+    for filename in filenames:
+        if os.path.isfile(filename):
+            with open(filename) as f:
+                contents = f.read()
+            if re.search(r'#define\s+PETSC_HAVE_THREADSAFETY\s+1', contents):
+                option_set.add('TRUE')
+            else:
+                option_set.add('FALSE')
+            return option_set
+
+    # Without a PETSc configuration the thread safety cannot be confirmed
+    option_set.add('FALSE')
+    return option_set
+
 def getPetscVersion(libmesh_dir):
     major_version = getLibMeshConfigOption(libmesh_dir, 'petsc_major')
     minor_version = getLibMeshConfigOption(libmesh_dir, 'petsc_minor')
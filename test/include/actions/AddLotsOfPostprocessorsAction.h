@@ -0,0 +1,31 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef ADDLOTSOFPOSTPROCESSORSACTION_H
+#define ADDLOTSOFPOSTPROCESSORSACTION_H
+
+#include "Action.h"
+
+class AddLotsOfPostprocessorsAction;
+
+template <>
+InputParameters validParams<AddLotsOfPostprocessorsAction>();
+
+/**
+ * Adds many Receiver postprocessors, to time and check the construction of many objects.
+ */
+class AddLotsOfPostprocessorsAction : public Action
+{
+public:
+  AddLotsOfPostprocessorsAction(const InputParameters & parameters);
+
+  virtual void act() override;
+};
+
+#endif // ADDLOTSOFPOSTPROCESSORSACTION_H
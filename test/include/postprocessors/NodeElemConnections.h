@@ -0,0 +1,40 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef NODEELEMCONNECTIONS_H
+#define NODEELEMCONNECTIONS_H
+
+#include "GeneralPostprocessor.h"
+
+// Forward Declarations
+class NodeElemConnections;
+
+template <>
+InputParameters validParams<NodeElemConnections>();
+
+/**
+ * Returns the number of node to element connections in the node to elem map of the mesh
+ * and checks them against the connectivity of the elements.
+ */
+class NodeElemConnections : public GeneralPostprocessor
+{
+public:
+  NodeElemConnections(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+
+  virtual Real getValue() override;
+
+protected:
+  /// Whether to check the map of the active semilocal elements
+  const bool _semilocal;
+};
+
+#endif // NODEELEMCONNECTIONS_H
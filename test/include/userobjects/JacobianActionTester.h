@@ -0,0 +1,43 @@
+//* This file is part of the MOOSE framework
+//* https://www.mooseframework.org
+//*
+//* All rights reserved, see COPYRIGHT for full restrictions
+//* https://github.com/idaholab/moose/blob/master/COPYRIGHT
+//*
+//* Licensed under LGPL 2.1, please see LICENSE for details
+//* https://www.gnu.org/licenses/lgpl-2.1.html
+
+#ifndef JACOBIANACTIONTESTER_H
+#define JACOBIANACTIONTESTER_H
+
+#include "GeneralUserObject.h"
+
+class JacobianActionTester;
+
+template <>
+InputParameters validParams<JacobianActionTester>();
+
+/**
+ * Compares the Jacobian applied element by element (as for the MATRIX_FREE solve type) to the
+ * product of the assembled Jacobian with a vector, and the diagonals of both.
+ */
+class JacobianActionTester : public GeneralUserObject
+{
+public:
+  JacobianActionTester(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+protected:
+  /// Relative tolerance of the difference of the products
+  const Real _tolerance;
+
+  /// Error out if the difference of the two vectors exceeds the tolerance
+  void compare(NumericVector<Number> & action,
+               const NumericVector<Number> & assembled,
+               const std::string & what) const;
+};
+
+#endif // JACOBIANACTIONTESTER_H
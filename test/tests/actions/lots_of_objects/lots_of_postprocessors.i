@@ -0,0 +1,28 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Testing]
+  [./LotsOfPostprocessors]
+    [./pp]
+      number = 100
+    [../]
+  [../]
+[]
+
+[Postprocessors]
+  [./total]
+    type = Receiver
+    default = 1
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
@@ -0,0 +1,53 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 5
+  ny = 5
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  # The left and bottom boundaries meet at a corner node
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./bottom]
+    type = DirichletBC
+    variable = u
+    boundary = bottom
+    value = 1
+  [../]
+  # A single BC on two boundaries that meet at a corner node
+  [./top_right]
+    type = DirichletBC
+    variable = u
+    boundary = 'top right'
+    value = 2
+  [../]
+[]
+
+[UserObjects]
+  [./jacobian_action]
+    type = JacobianActionTester
+    execute_on = timestep_end
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
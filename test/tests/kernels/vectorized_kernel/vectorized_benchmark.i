@@ -0,0 +1,57 @@
+# Transient diffusion-reaction problem used to compare the vectorized kernels (default) against
+# the scalar path (Kernels/*/vectorize=false) for first and second order elements
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 10
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+  [../]
+[]
+
+[Kernels]
+  [./time]
+    type = VectorizedTimeDerivative
+    variable = u
+  [../]
+  [./diff]
+    type = VectorizedDiffusion
+    variable = u
+  [../]
+  [./reaction]
+    type = VectorizedReaction
+    variable = u
+  [../]
+  [./force]
+    type = VectorizedBodyForce
+    variable = u
+    function = 'sin(x) * cos(y)'
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 5
+  dt = 0.1
+  solve_type = NEWTON
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  perf_graph = true
+[]
@@ -0,0 +1,67 @@
+# Same problem as kernels/2d_diffusion/2d_diffusion_bodyforce_test.i with the vectorized kernels
+
+[Mesh]
+  file = ../2d_diffusion/square.e
+[]
+
+[Variables]
+  [./u]
+    order = FIRST
+    family = LAGRANGE
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = VectorizedDiffusion
+    variable = u
+  [../]
+  [./bf]
+    type = VectorizedBodyForce
+    variable = u
+    postprocessor = ramp
+  [../]
+[]
+
+[Functions]
+  [./ramp]
+    type = ParsedFunction
+    value = 't'
+  [../]
+[]
+
+[Postprocessors]
+  [./ramp]
+    type = FunctionValuePostprocessor
+    function = ramp
+    execute_on = linear
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = 1
+    value = 0
+  [../]
+
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = 2
+    value = 0
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1.0
+  end_time = 1.0
+
+  solve_type = 'NEWTON'
+[]
+
+[Outputs]
+  exodus = true
+[]
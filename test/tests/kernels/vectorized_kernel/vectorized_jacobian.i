@@ -0,0 +1,46 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 3
+  ny = 3
+[]
+
+[Variables]
+  [./u]
+    order = SECOND
+  [../]
+[]
+
+[ICs]
+  [./u]
+    type = FunctionIC
+    variable = u
+    function = 'x*x + 2*y'
+  [../]
+[]
+
+[Kernels]
+  [./time]
+    type = VectorizedTimeDerivative
+    variable = u
+  [../]
+  [./diff]
+    type = VectorizedDiffusion
+    variable = u
+  [../]
+  [./reaction]
+    type = VectorizedReaction
+    variable = u
+  [../]
+  [./force]
+    type = VectorizedBodyForce
+    variable = u
+    function = 'x + y'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+  solve_type = NEWTON
+[]
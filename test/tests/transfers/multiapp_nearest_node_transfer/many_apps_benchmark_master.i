@@ -0,0 +1,85 @@
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 200
+  ny = 200
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./from_sub]
+  [../]
+  [./elemental_from_sub]
+    order = CONSTANT
+    family = MONOMIAL
+  [../]
+[]
+
+[Kernels]
+  [./diff]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = u
+    boundary = left
+    value = 0
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = u
+    boundary = right
+    value = 1
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 2
+  dt = 1
+
+  solve_type = 'NEWTON'
+[]
+
+[MultiApps]
+  [./sub]
+    # 1000 small sub-apps covering the master domain
+    type = TransientMultiApp
+    app_type = MooseTestApp
+    positions_file = many_apps_benchmark_positions.txt
+    input_files = many_apps_benchmark_sub.i
+    execute_on = timestep_end
+  [../]
+[]
+
+[Transfers]
+  [./from_sub]
+    type = MultiAppNearestNodeTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = from_sub
+  [../]
+  [./elemental_from_sub]
+    type = MultiAppNearestNodeTransfer
+    direction = from_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = elemental_from_sub
+  [../]
+  [./to_sub]
+    type = MultiAppNearestNodeTransfer
+    direction = to_multiapp
+    multi_app = sub
+    source_variable = u
+    variable = from_master
+  [../]
+[]